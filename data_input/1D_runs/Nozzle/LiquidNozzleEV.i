@@ -573,7 +573,10 @@ length = 1.
 ##############################################################################################
 
 [Executioner]
-  type = Transient
+  type = EelLaggedJacobianTransient # Transient
+  max_jacobian_age = 5
+  max_linear_its = 20
+  max_contraction_rate = 0.5
   scheme = 'bdf2'
   end_time = 2.
   dt = 1.e-3
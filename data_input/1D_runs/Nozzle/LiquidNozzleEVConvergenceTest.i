@@ -1,4 +1,6 @@
 #
+# Refinement study: ./convergence_study -i data_input/1D_runs/Nozzle/LiquidNozzleEVConvergenceTest.i --levels 16 32 64 128
+#
 #####################################################
 # Define some global parameters used in the blocks. #
 #####################################################
@@ -28,6 +30,7 @@ temp_init_left = 453
 temp_init_right = 453
 membrane = 0.5
 length = 1.
+error_times = '0.5 1.'
 []
 
 #############################################################################
@@ -81,6 +84,7 @@ length = 1.
     Bo = 0.0
   [../]
   
+  # The exact solution is tabulated once and interpolated; the errors are only computed at 'error_times'.
   [./exact_sol_press]
     type = ExactSolAreaVariable
     variable_name = PRESSURE
@@ -493,19 +497,19 @@ length = 1.
   [../]
 
   [./L2ErrorPressure]
-    type = ElementL2Error
+    type = ElementL2ErrorNorm
     variable = pressure_aux
     function = exact_sol_press
   [../]
 
   [./L2ErrorDensity]
-    type = ElementL2Error
+    type = ElementL2ErrorNorm
     variable = density_aux
     function = exact_sol_dens
   [../]
 
   [./L2ErrorVel]
-    type = ElementL2Error
+    type = ElementL2ErrorNorm
     variable = velocity_aux
     function = exact_sol_vel
   [../]
@@ -41,6 +41,15 @@ membrane = 0.5
   	q_prime =  -23e2 # reference entropy
   [../]
 
+  # Auxiliary equation of the C-method, solved once per time step after the Euler system:
+  [./CMethod]
+    type = EelCMethodSolver
+    variable = C
+    pressure = pressure_aux
+    max_eig_pps = MaxEigPPs
+    execute_on = timestep
+  [../]
+
 []
 
 ###### Mesh #######
@@ -88,15 +97,6 @@ membrane = 0.5
         area = area
 	[../]
   [../]
-
-  [./C]
-    family = LAGRANGE
-    scaling = 1e-6
-    [./InitialCondition]
-    type = ConstantIC
-    value = 0.
-    [../]
-  [../]
 []
 
 ############################################################################################################
@@ -122,11 +122,6 @@ membrane = 0.5
     variable = rhoEA
   [../]
 
-  [./CTime]
-    type = EelTimeDerivative
-    variable = C
-  [../]
-
   [./Mass]
     type = EelMass
     variable = rhoA
@@ -150,14 +145,6 @@ membrane = 0.5
     area = area_aux
   [../]
 
-  [./CSpace]
-    type = EelCMethod
-   variable = C
-    pressure = pressure_aux
-   max_eig_pps = MaxEigPPs
-    max_grad_pps = MaxGradientPPs
-  [../]
-
   [./MassVisc]
     type = EelArtificialVisc
     variable = rhoA
@@ -197,6 +184,10 @@ membrane = 0.5
 
 [AuxVariables]
 
+   [./C]
+      family = LAGRANGE
+   [../]
+
    [./area_aux]
       family = LAGRANGE
    [../]
@@ -501,20 +492,6 @@ membrane = 0.5
     boundary = 'right'
   [../]
 
-  [./CInflowBC]
-    type = NeumannBC
-    variable = C
-    value = 0.
-    boundary = 'left'
-  [../]
-
-  [./COutflowBC]
-    type = NeumannBC
-    variable = C
-    value = 0.
-    boundary = 'right'
-  [../]
-
 []
 
 ##############################################################################################
@@ -92,6 +92,12 @@ length = 1.
     Bo = 0.0
   [../]
 
+  # Same profile tabulated (set 'area = area_table' in AreaAux to use it):
+  [./area_table]
+    type = TabulatedAreaFunction
+    data_file = nozzle_area.dat
+  [../]
+
 []
 
 #############################################################################
@@ -0,0 +1,132 @@
+#
+#####################################################
+# Cavitation tube solved with the explicit          #
+# edge-based executioner (graph viscosity with      #
+# convex limiting).                                 #
+#####################################################
+#
+
+[GlobalParams]
+###### Initial Conditions #######
+pressure_init_left = 101325.
+pressure_init_right = 101325.
+vel_init_left = -100.
+vel_init_right = 100.
+temp_init_left = 300.
+temp_init_right = 300.
+membrane = 0.5
+length = 1e-6
+[]
+
+##############################################################################################
+#                                       FUNCTIONs                                            #
+##############################################################################################
+# Define functions that are used in the kernels and aux. kernels.                            #
+##############################################################################################
+
+[Functions]
+  [./area]
+    type = ParsedFunction
+    value = 1.
+  [../]
+[]
+
+#############################################################################
+#                          USER OBJECTS                                     #
+#############################################################################
+# Define the user object class that store the EOS parameters.               #
+#############################################################################
+
+[UserObjects]
+  [./eos]
+    type = StiffenedGasEquationOfState
+    gamma = 4.4
+    Pinf = 6.e8
+    q = 0.
+    Cv = 1.e3
+    q_prime = 0.
+  [../]
+[]
+
+###### Mesh #######
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 400
+  xmin = 0.
+  xmax = 1.
+  block_id = '0'
+[]
+
+#############################################################################
+#                             VARIABLES                                     #
+#############################################################################
+# The variables only store the initial conditions and the solution for the #
+# output: no kernel is needed.                                              #
+#############################################################################
+
+[Variables]
+  [./rhoA]
+    family = LAGRANGE
+	[./InitialCondition]
+        type = ConservativeVariables1DXIC
+        eos = eos
+        area = area
+	[../]
+  [../]
+
+  [./rhouA]
+    family = LAGRANGE
+    [./InitialCondition]
+        type = ConservativeVariables1DXIC
+        eos = eos
+        area = area
+    [../]
+  [../]
+
+  [./rhoEA]
+    family = LAGRANGE
+	[./InitialCondition]
+        type = ConservativeVariables1DXIC
+        eos = eos
+        area = area
+	[../]
+  [../]
+[]
+
+##############################################################################################
+#                                     EXECUTIONER                                            #
+##############################################################################################
+# Graph viscosity with convex limiting: the time step is set by the CFL number only.        #
+##############################################################################################
+
+[Executioner]
+  type = EelEdgeBasedTransient
+  end_time = 1826e-5
+  cfl = 1.
+  output_interval = 100
+  eos = eos
+  viscosity_name = SMOOTHNESS
+  convex_limiting = true
+  rhoA = rhoA
+  rhouA_x = rhouA
+  rhoEA = rhoEA
+  area = area
+  dirichlet_boundaries = 'left right'
+[]
+
+##############################################################################################
+#                                        OUTPUT                                              #
+##############################################################################################
+# Define the functions computing the inflow and outflow boundary conditions.                 #
+##############################################################################################
+
+[Outputs]
+  output_initial = true
+  file_base = CavitationTubeEdge_out
+  postprocessor_screen = false
+  interval = 1
+  console = true
+  exodus = true
+  perf_log = true
+[]
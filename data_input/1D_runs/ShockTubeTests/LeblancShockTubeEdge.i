@@ -0,0 +1,131 @@
+#
+#####################################################
+# Leblanc shock tube solved with the explicit       #
+# edge-based executioner (graph viscosity with      #
+# convex limiting).                                 #
+#####################################################
+#
+
+[GlobalParams]
+###### Initial Conditions #######
+pressure_init_left = 0.066667
+pressure_init_right = 0.666667e-10
+vel_init_left = 0.
+vel_init_right = 0.
+temp_init_left = 0.0666667
+temp_init_right = 0.6666667e-7
+membrane = 2
+length = 0.
+[]
+
+##############################################################################################
+#                                       FUNCTIONs                                            #
+##############################################################################################
+# Define functions that are used in the kernels and aux. kernels.                            #
+##############################################################################################
+
+[Functions]
+  [./area]
+    type = ParsedFunction
+    value = 1.
+  [../]
+[]
+
+#############################################################################
+#                          USER OBJECTS                                     #
+#############################################################################
+# Define the user object class that store the EOS parameters.               #
+#############################################################################
+
+[UserObjects]
+  [./eos]
+    type = StiffenedGasEquationOfState
+  	gamma = 1.66666667
+  	Pinf = 0
+  	q = 0.
+  	Cv = 1.5
+  	q_prime = 0.
+  [../]
+[]
+
+###### Mesh #######
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 1000
+  xmin = 0.
+  xmax = 9.
+  block_id = '0'
+[]
+
+#############################################################################
+#                             VARIABLES                                     #
+#############################################################################
+# The variables only store the initial conditions and the solution for the #
+# output: no kernel is needed.                                              #
+#############################################################################
+
+[Variables]
+  [./rhoA]
+    family = LAGRANGE
+	[./InitialCondition]
+        type = ConservativeVariables1DXIC
+        eos = eos
+        area = area
+	[../]
+  [../]
+
+  [./rhouA]
+    family = LAGRANGE
+    [./InitialCondition]
+        type = ConservativeVariables1DXIC
+        eos = eos
+        area = area
+    [../]
+  [../]
+
+  [./rhoEA]
+    family = LAGRANGE
+	[./InitialCondition]
+        type = ConservativeVariables1DXIC
+        eos = eos
+        area = area
+	[../]
+  [../]
+[]
+
+##############################################################################################
+#                                     EXECUTIONER                                            #
+##############################################################################################
+# Graph viscosity with convex limiting: the time step is set by the CFL number only.        #
+##############################################################################################
+
+[Executioner]
+  type = EelEdgeBasedTransient
+  end_time = 4.
+  cfl = 1.
+  output_interval = 100
+  eos = eos
+  viscosity_name = SMOOTHNESS
+  convex_limiting = true
+  rhoA = rhoA
+  rhouA_x = rhouA
+  rhoEA = rhoEA
+  area = area
+[]
+
+##############################################################################################
+#                                        OUTPUT                                              #
+##############################################################################################
+# Define the functions computing the inflow and outflow boundary conditions.                 #
+##############################################################################################
+
+[Outputs]
+  output_initial = true
+  file_base = LeblancEdge_nel_1000_out
+  postprocessor_screen = false
+  interval = 1
+  console = true
+  exodus = true
+  perf_log = true
+[]
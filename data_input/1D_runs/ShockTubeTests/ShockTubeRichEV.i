@@ -36,6 +36,25 @@ membrane = 40
 ##############################################################################################
 
 [Functions]
+  # Exact solution of the Riemann problem defined by the initial conditions of the GlobalParams:
+  [./exact_dens]
+    type = ExactRiemannSolution
+    variable_name = DENSITY
+    eos = eos
+  [../]
+
+  [./exact_vel]
+    type = ExactRiemannSolution
+    variable_name = VELOCITY
+    eos = eos
+  [../]
+
+  [./exact_press]
+    type = ExactRiemannSolution
+    variable_name = PRESSURE
+    eos = eos
+  [../]
+
 #  [./Hw_fn]
 #    type = ParsedFunction
 #    value = 0.
@@ -421,6 +440,24 @@ membrane = 40
 # Define functions that are used in the kernels and aux. kernels.                            #
 ##############################################################################################
 [Postprocessors]
+  [./L1ErrorDensity]
+    type = ElementL1Error
+    variable = density_aux
+    function = exact_dens
+  [../]
+
+  [./L1ErrorVel]
+    type = ElementL1Error
+    variable = velocity_aux
+    function = exact_vel
+  [../]
+
+  [./L1ErrorPressure]
+    type = ElementL1Error
+    variable = pressure_aux
+    function = exact_press
+  [../]
+
 #  [./MaxVelocity]
 #    type = NodalMaxValue
 #    variable = norm_vel_aux
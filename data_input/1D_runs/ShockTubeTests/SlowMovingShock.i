@@ -33,6 +33,25 @@ length = 0.
 ##############################################################################################
 
 [Functions]
+  # Exact solution of the Riemann problem defined by the initial conditions of the GlobalParams:
+  [./exact_dens]
+    type = ExactRiemannSolution
+    variable_name = DENSITY
+    eos = eos
+  [../]
+
+  [./exact_vel]
+    type = ExactRiemannSolution
+    variable_name = VELOCITY
+    eos = eos
+  [../]
+
+  [./exact_press]
+    type = ExactRiemannSolution
+    variable_name = PRESSURE
+    eos = eos
+  [../]
+
   [./area]
     type = ParsedFunction
     value = 1.
@@ -440,6 +459,24 @@ length = 0.
 # Define functions that are used in the kernels and aux. kernels.                            #
 ##############################################################################################
 [Postprocessors]
+  [./L1ErrorDensity]
+    type = ElementL1Error
+    variable = density_aux
+    function = exact_dens
+  [../]
+
+  [./L1ErrorVel]
+    type = ElementL1Error
+    variable = velocity_aux
+    function = exact_vel
+  [../]
+
+  [./L1ErrorPressure]
+    type = ElementL1Error
+    variable = pressure_aux
+    function = exact_press
+  [../]
+
   [./MaxDpressureDt]
     type = ElementMaxDuDtValue
     variable = pressure_aux
@@ -15,6 +15,7 @@ order = FIRST
 viscosity_name = ENTROPY
 diffusion_name = PARABOLIC
 isJumpOn = true
+visc_jacobian = false # set to true to add dmu/dU and dkappa/dU to the jacobian matrix
 #Ce = 1.
 Cjump = 3.
 useVelPps = true
@@ -203,6 +204,9 @@ membrane = 0.7
     internal_energy = internal_energy_aux
     norm_velocity = norm_vel_aux
     area = area_aux
+    rhoA = rhoA
+    rhouA_x = rhouA
+    rhoEA = rhoEA
   [../]
 
    [./MomentumVisc]
@@ -214,6 +218,9 @@ membrane = 0.7
     internal_energy = internal_energy_aux
     norm_velocity = norm_vel_aux
     area = area_aux
+    rhoA = rhoA
+    rhouA_x = rhouA
+    rhoEA = rhoEA
   [../]
 
    [./EnergyVisc]
@@ -225,6 +232,9 @@ membrane = 0.7
     internal_energy = internal_energy_aux
     norm_velocity = norm_vel_aux
     area = area_aux
+    rhoA = rhoA
+    rhouA_x = rhouA
+    rhoEA = rhoEA
   [../]
 []
 
@@ -412,6 +422,9 @@ membrane = 0.7
     jump_grad_press = jump_grad_press_smooth_aux
     jump_grad_dens = jump_grad_dens_smooth_aux
     eos = eos
+    rhoA = rhoA
+    rhouA_x = rhouA
+    rhoEA = rhoEA
     velocity_PPS_name = AverageVelocity
   [../]
 
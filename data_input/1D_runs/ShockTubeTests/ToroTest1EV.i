@@ -10,6 +10,7 @@ order = FIRST
 viscosity_name = ENTROPY
 diffusion_name = ENTROPY
 isJumpOn = true
+visc_jacobian = false # set to true to add dmu/dU and dkappa/dU to the jacobian matrix
 Ce = 1.
 Cjump = 5.
 isShock = true
@@ -32,6 +33,25 @@ length = 0.
 ##############################################################################################
 
 [Functions]
+  # Exact solution of the Riemann problem defined by the initial conditions of the GlobalParams:
+  [./exact_dens]
+    type = ExactRiemannSolution
+    variable_name = DENSITY
+    eos = eos
+  [../]
+
+  [./exact_vel]
+    type = ExactRiemannSolution
+    variable_name = VELOCITY
+    eos = eos
+  [../]
+
+  [./exact_press]
+    type = ExactRiemannSolution
+    variable_name = PRESSURE
+    eos = eos
+  [../]
+
   [./area]
     type = ParsedFunction
     value = 1.
@@ -192,6 +212,9 @@ length = 0.
     internal_energy = internal_energy_aux
     norm_velocity = norm_vel_aux
     area = area_aux
+    rhoA = rhoA
+    rhouA_x = rhouA
+    rhoEA = rhoEA
   [../]
 
    [./MomentumVisc]
@@ -203,6 +226,9 @@ length = 0.
     internal_energy = internal_energy_aux
     norm_velocity = norm_vel_aux
     area = area_aux
+    rhoA = rhoA
+    rhouA_x = rhouA
+    rhoEA = rhoEA
   [../]
 
    [./EnergyVisc]
@@ -214,6 +240,9 @@ length = 0.
     internal_energy = internal_energy_aux
     norm_velocity = norm_vel_aux
     area = area_aux
+    rhoA = rhoA
+    rhouA_x = rhouA
+    rhoEA = rhoEA
   [../]
 []
 
@@ -401,6 +430,9 @@ length = 0.
     jump_grad_press = jump_grad_press_smooth_aux
     jump_grad_dens = jump_grad_dens_smooth_aux
     eos = eos
+    rhoA = rhoA
+    rhouA_x = rhouA
+    rhoEA = rhoEA
     rhov2_PPS_name = AverageRhovel2
 #    rhoc2_PPS_name = AverageRhoc2
   [../]
@@ -413,6 +445,24 @@ length = 0.
 # Define functions that are used in the kernels and aux. kernels.                            #
 ##############################################################################################
 [Postprocessors]
+  [./L1ErrorDensity]
+    type = ElementL1Error
+    variable = density_aux
+    function = exact_dens
+  [../]
+
+  [./L1ErrorVel]
+    type = ElementL1Error
+    variable = velocity_aux
+    function = exact_vel
+  [../]
+
+  [./L1ErrorPressure]
+    type = ElementL1Error
+    variable = pressure_aux
+    function = exact_press
+  [../]
+
 [./AverageRhovel2]
     type = ElementAverageMultipleValues
     variable = norm_vel_aux
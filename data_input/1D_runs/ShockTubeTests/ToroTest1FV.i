@@ -0,0 +1,135 @@
+#
+#####################################################
+# Toro test 1 solved with the cell-centered finite  #
+# volume executioner (MUSCL-Hancock scheme with     #
+# HLLC fluxes).                                     #
+#####################################################
+#
+
+[GlobalParams]
+###### Initial Conditions #######
+pressure_init_left = 1.0
+pressure_init_right = 0.1
+vel_init_left = 0.75
+vel_init_right = 0
+temp_init_left = 1.
+temp_init_right = 0.8
+membrane = 0.3
+length = 0.
+[]
+
+##############################################################################################
+#                                       FUNCTIONs                                            #
+##############################################################################################
+# Define functions that are used in the kernels and aux. kernels.                            #
+##############################################################################################
+
+[Functions]
+  [./area]
+    type = ParsedFunction
+    value = 1.
+  [../]
+[]
+
+#############################################################################
+#                          USER OBJECTS                                     #
+#############################################################################
+# Define the user object class that store the EOS parameters.               #
+#############################################################################
+
+[UserObjects]
+  [./eos]
+    type = StiffenedGasEquationOfState
+  	gamma = 1.4
+  	Pinf = 0
+  	q = 0.
+  	Cv = 2.5
+  	q_prime = 0.
+  [../]
+[]
+
+###### Mesh #######
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 400
+  xmin = 0.
+  xmax = 1.
+  block_id = '0'
+[]
+
+#############################################################################
+#                             VARIABLES                                     #
+#############################################################################
+# Constant monomial variables: they store the initial conditions and the   #
+# cell averages for the output, no kernel is needed.                        #
+#############################################################################
+
+[Variables]
+  [./rhoA]
+    order = CONSTANT
+    family = MONOMIAL
+	[./InitialCondition]
+        type = ConservativeVariables1DXIC
+        eos = eos
+        area = area
+	[../]
+  [../]
+
+  [./rhouA]
+    order = CONSTANT
+    family = MONOMIAL
+    [./InitialCondition]
+        type = ConservativeVariables1DXIC
+        eos = eos
+        area = area
+    [../]
+  [../]
+
+  [./rhoEA]
+    order = CONSTANT
+    family = MONOMIAL
+	[./InitialCondition]
+        type = ConservativeVariables1DXIC
+        eos = eos
+        area = area
+	[../]
+  [../]
+[]
+
+##############################################################################################
+#                                     EXECUTIONER                                            #
+##############################################################################################
+# The boundaries are transmissive: the waves do not reach them before the end time.        #
+##############################################################################################
+
+[Executioner]
+  type = EelFVTransient
+  end_time = 0.2
+  cfl = 0.9
+  output_interval = 100
+  eos = eos
+  scheme_name = MUSCL_HANCOCK
+  rhoA = rhoA
+  rhouA_x = rhouA
+  rhoEA = rhoEA
+  area = area
+  quiescent_masking = true
+  quiescent_tolerance = 0.
+[]
+
+##############################################################################################
+#                                        OUTPUT                                              #
+##############################################################################################
+# Define the functions computing the inflow and outflow boundary conditions.                 #
+##############################################################################################
+
+[Outputs]
+  output_initial = true
+  file_base = ToroTest1FV_out
+  postprocessor_screen = false
+  interval = 1
+  console = true
+  exodus = true
+  perf_log = true
+[]
@@ -0,0 +1,68 @@
+#
+#####################################################
+# Toro tests 1 to 5 run as one ensemble of pipes.   #
+# The solution of test k+1 is written in            #
+# ToroTestsEnsemble_k.csv.                          #
+#####################################################
+#
+
+##############################################################################################
+#                                       FUNCTIONs                                            #
+##############################################################################################
+# Define functions that are used in the kernels and aux. kernels.                            #
+##############################################################################################
+
+[Functions]
+  [./area]
+    type = ParsedFunction
+    value = 1.
+  [../]
+[]
+
+##############################################################################################
+#                                         MESH                                               #
+##############################################################################################
+# Mesh shared by all the instances of the ensemble.                                          #
+##############################################################################################
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 500
+  xmin = 0
+  xmax = 1
+  block_id = '0'
+[]
+
+##############################################################################################
+#                                     EXECUTIONER                                            #
+##############################################################################################
+# One value per instance, or one value for all the instances.                               #
+##############################################################################################
+
+[Executioner]
+  type = EelEnsembleTransient
+  end_time = '0.2 0.15 0.012 0.035 0.012'
+  cfl = 0.5
+  area = area
+  left_bc = TRANSMISSIVE
+  right_bc = TRANSMISSIVE
+  ###### Equation of state #######
+  gamma = 1.4
+  Pinf = 0.
+  q = 0.
+  Cv = 2.5
+  ###### Viscosity #######
+  Ce = 1.
+  Cjump = '5. 1. 5. 5. 5.'
+  Cmax = 0.5
+  ###### Initial Conditions #######
+  membrane = '0.3 0.5 0.5 0.4 0.8'
+  pressure_init_left = '1.0 0.4 1000. 460.894 1000.'
+  pressure_init_right = '0.1 0.4 0.01 46.0950 0.01'
+  vel_init_left = '0.75 -2. 0. 19.5975 -19.59745'
+  vel_init_right = '0. 2. 0. -6.19633 -19.59745'
+  temp_init_left = '1. 0.4 1000. 76.8250 1000.'
+  temp_init_right = '0.8 0.4 0.01 7.69221 0.01'
+  file_base = ToroTestsEnsemble
+[]
@@ -520,7 +520,7 @@ length = 0.0
   [./SMP_Newton]
     type = SMP
     full = true
-    solve_type = 'PJFNK' # PJFNK, JFNK, NEWTON, FD
+    solve_type = 'NEWTON' # PJFNK, JFNK, NEWTON, FD
     line_search = 'default'
   [../]
 []
@@ -532,7 +532,8 @@ length = 0.0
 ##############################################################################################
 
 [Executioner]
-  type = Transient   # Here we use the Transient Executioner
+  type = EelBlockTridiagonalTransient   # Transient Executioner with a block-tridiagonal solver for 1D runs
+  direct_solve = true
   string scheme = 'bdf2'
   #rk_scheme = 'sdirk33'
   num_steps = 1000
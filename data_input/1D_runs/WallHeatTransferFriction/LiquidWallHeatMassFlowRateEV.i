@@ -46,15 +46,16 @@ membrane = 0.5
 ##############################################################################################
 
 [Functions]
+  # The wall functions are evaluated at every quadrature point: they are compiled (EelCompiledFunction).
   [./Hw_fn]
-    type = ParsedFunction
+    type = EelCompiledFunction
     value = H0*sin(pi*x/3.865)*(1-exp(-a*t))  # no space between operators
     vars = 'H0    a '  # beta is a factor to affect the transition duration ~ 1/beta
     vals = '5.33e4    1.'
   [../]
 
   [./Tw_fn]
-    type = ParsedFunction
+    type = EelCompiledFunction
     value = Tw*exp(-alpha*x/L)*sin(0.5*pi*x/L)+Tmin
     vars = 'Tw    alpha     L    Tmin'
     vals = '600   1.96      3.865.    559.15'
@@ -76,11 +76,17 @@ Hw_fn = Hw_fn
     variable = jump_grad_dens_aux
     var_name = smooth_jump_grad_dens_aux
   [../]
+
+  [./Renumbering]
+    type = EelRenumberMesh
+    curve = HILBERT
+    execute_on = timestep_begin
+  [../]
 []
 
 ###### Mesh #######
 [Mesh]
-  uniform_refine = 4
+  uniform_refine = 1
   file = compression_corner.e
   block_id = '1'
   boundary_id = '1 2 3'
@@ -685,6 +691,9 @@ Hw_fn = Hw_fn
     full = true
     solve_type = 'PJFNK'
     line_search = 'none'
+    # Reverse Cuthill-McKee ordering of the ILU factorization:
+    petsc_options_iname = '-pc_factor_mat_ordering_type'
+    petsc_options_value = 'rcm'
 #petsc_options = '-snes'
 #petsc_options_iname = 'pc_type'
 #petsc_options_value = 'lu'
@@ -698,8 +707,12 @@ Hw_fn = Hw_fn
 ##############################################################################################
 
 [Executioner]
-  type = Transient
+  type = EelMeshSequencingTransient
   string scheme = 'bdf2'
+  ###### Three refinements of the quasi-steady solution: resolution of uniform_refine = 4 #####
+  num_refinements = 3
+  sequence_tolerance = 1.e-2
+  sequence_max_steps = 300
   #num_steps = 100
   end_time = 1.5
   dt = 1.e-4
@@ -700,6 +700,9 @@ Hw_fn = Hw_fn
 
 [Executioner]
   type = Transient
+  # Node-block Jacobi preconditioner with single precision blocks (remove -pc_type from the Preconditioning block):
+  #type = EelBlockJacobiTransient
+  #single_precision = true
   string scheme = 'bdf2'
   #num_steps = 100
   end_time = 1.5
@@ -0,0 +1,200 @@
+#
+#####################################################
+# Double Mach reflection solved with the cell-      #
+# centered finite volume executioner (MUSCL-Hancock #
+# with HLLC fluxes). The mesh and the initial       #
+# conditions are the ones of DoubleMachReflection.i #
+#####################################################
+#
+[GlobalParams]
+###### Initial conditions ######
+pressure_init_left = 116.5
+pressure_init_right = 1.
+vel_x_init_left = 1.272574462
+vel_x_init_right = 0.
+vel_y_init_left = -1.272574462
+vel_y_init_right = 0.
+rho_init_left = 8.
+rho_init_right = 1.
+x_point_source = -1.83333333
+y_point_source = 0.333333333
+[]
+
+##############################################################################################
+#                                       FUNCTIONs                                            #
+##############################################################################################
+# Define functions that are used in the kernels and aux. kernels.                            #
+##############################################################################################
+
+[Functions]
+  [./area]
+    type = ParsedFunction
+    value = 1.
+  [../]
+[]
+
+#############################################################################
+#                          USER OBJECTS                                     #
+#############################################################################
+# Define the user object class that store the EOS parameters.               #
+#############################################################################
+
+[UserObjects]
+  [./eos]
+    type = StiffenedGasEquationOfState
+  	gamma = 1.4
+  	Pinf = 0.
+  	q = 0.
+  	Cv =  2.5
+  	q_prime = 0.
+  [../]
+[]
+
+###### Mesh #######
+[Mesh]
+  uniform_refine = 3
+  file = double_mach_reflection.e
+  block_id = '1'
+  boundary_id = '1 2 3'
+  boundary_name = 'wall outflow inflow'
+[]
+
+#############################################################################
+#                             VARIABLES                                     #
+#############################################################################
+# Constant monomial variables: they store the initial conditions and the   #
+# cell averages for the output, no kernel is needed.                        #
+#############################################################################
+
+[Variables]
+  [./rhoA]
+    order = CONSTANT
+    family = MONOMIAL
+	[./InitialCondition]
+        type = DoubleMachReflectionIC
+        eos = eos
+        area = area
+	[../]
+  [../]
+
+  [./rhouA]
+    order = CONSTANT
+    family = MONOMIAL
+	[./InitialCondition]
+        type = DoubleMachReflectionIC
+        eos = eos
+        area = area
+	[../]
+  [../]
+
+  [./rhovA]
+    order = CONSTANT
+    family = MONOMIAL
+    [./InitialCondition]
+        type = DoubleMachReflectionIC
+        eos = eos
+        area = area
+    [../]
+   [../]
+
+  [./rhoEA]
+    order = CONSTANT
+    family = MONOMIAL
+	[./InitialCondition]
+        type = DoubleMachReflectionIC
+        eos = eos
+        area = area
+	[../]
+  [../]
+[]
+
+##############################################################################################
+#                                       AUXILARY VARIABLES                                   #
+##############################################################################################
+# Define the auxilary variables                                                              #
+##############################################################################################
+
+[AuxVariables]
+   [./area_aux]
+      order = CONSTANT
+      family = MONOMIAL
+   [../]
+
+   [./density_aux]
+      order = CONSTANT
+      family = MONOMIAL
+   [../]
+
+   [./pressure_aux]
+      order = CONSTANT
+      family = MONOMIAL
+   [../]
+[]
+
+##############################################################################################
+#                                       AUXILARY KERNELS                                     #
+##############################################################################################
+# Define the auxilary kernels for liquid and gas phases. Same index as for variable block.   #
+##############################################################################################
+
+[AuxKernels]
+  [./AreaAK]
+    type = AreaAux
+    variable = area_aux
+    area = area
+  [../]
+
+  [./DensAK]
+    type = DensityAux
+    variable = density_aux
+    rhoA = rhoA
+    area = area_aux
+  [../]
+
+  [./PressAK]
+    type = PressureAux
+    variable = pressure_aux
+    rhoA = rhoA
+    rhouA_x = rhouA
+    rhouA_y = rhovA
+    rhoEA = rhoEA
+    area = area_aux
+    eos = eos
+  [../]
+[]
+
+##############################################################################################
+#                                     EXECUTIONER                                            #
+##############################################################################################
+# The inflow is kept at the post-shock state and the outflow is transmissive.                #
+##############################################################################################
+
+[Executioner]
+  type = EelFVTransient
+  end_time = 0.2
+  cfl = 0.8
+  output_interval = 50
+  eos = eos
+  scheme_name = MUSCL_HANCOCK
+  rhoA = rhoA
+  rhouA_x = rhouA
+  rhouA_y = rhovA
+  rhoEA = rhoEA
+  area = area
+  wall_boundaries = 'wall'
+  dirichlet_boundaries = 'inflow'
+[]
+
+##############################################################################################
+#                                        OUTPUT                                              #
+##############################################################################################
+# Define the functions computing the inflow and outflow boundary conditions.                 #
+##############################################################################################
+
+[Output]
+  output_initial = true
+  postprocessor_screen = false
+  interval = 1
+  exodus = true
+  perf_log = true
+[]
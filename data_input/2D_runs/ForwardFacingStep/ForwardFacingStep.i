@@ -60,6 +60,21 @@ Hw_fn = Hw_fn
     execute_on = timestep_begin
   [../]
 
+  # Output-only fields, computed at the output interval instead of by auxiliary kernels:
+  [./DerivedFields]
+    type = EelDerivedFields
+    fields = 'TOTAL_ENERGY TEMPERATURE MACH_NUMBER'
+    variables = 'total_energy_aux temperature_aux mach_number_aux'
+    interval = 5
+    rhoA = rhoA
+    rhouA_x = rhouA
+    rhouA_y = rhovA
+    rhoEA = rhoEA
+    area = area
+    eos = eos
+    execute_on = timestep
+  [../]
+
 []
 
 ###### Mesh #######
@@ -266,10 +281,6 @@ Hw_fn = Hw_fn
 
    [./mach_number_aux]
     family = LAGRANGE
-    [./InitialCondition]
-    type = ConstantIC
-    value = 0.
-    [../]
    [../]
 
    [./density_aux]
@@ -282,10 +293,6 @@ Hw_fn = Hw_fn
 
    [./total_energy_aux]
       family = LAGRANGE
-	[./InitialCondition]
-	type = ConstantIC
-    value = 0.
-	[../]
    [../]
 
    [./internal_energy_aux]
@@ -374,13 +381,6 @@ Hw_fn = Hw_fn
     area = area_aux
   [../]
 
-  [./TotEnerAK]
-    type = TotalEnergyAux
-    variable = total_energy_aux
-    rhoEA = rhoEA
-    area = area_aux 
-  [../]
-
   [./IntEnerAK]
     type = InternalEnergyAux
     variable = internal_energy_aux
@@ -402,25 +402,6 @@ Hw_fn = Hw_fn
     eos = eos
   [../]
 
-  [./TempAK]
-    type = TemperatureAux
-    variable = temperature_aux
-    pressure = pressure_aux
-    density = density_aux
-    eos = eos
-  [../]
-
-  [./MachNumAK]
-    type = MachNumberAux
-    variable = mach_number_aux
-    pressure = pressure_aux
-    rhoA = rhoA
-    rhouA_x = rhouA
-    rhouA_y = rhovA
-    area = area_aux
-    eos = eos
-  [../]
-
   [./NormVelAK]
     type = NormVectorAux
     variable = norm_vel_aux
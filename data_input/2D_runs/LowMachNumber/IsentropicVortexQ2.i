@@ -0,0 +1,206 @@
+#
+#####################################################
+# Isentropic vortex advected by a uniform flow,     #
+# solved with the sum-factorized executioner on     #
+# QUAD9 elements (second order Lagrange). The L2    #
+# error of the density is printed at the end time:  #
+# run with Mesh/nx=10,20,40 (and Mesh/ny) for the   #
+# convergence study, and compare with               #
+# IsentropicVortexQ1.i at the same number of nodes. #
+#####################################################
+#
+[GlobalParams]
+###### Vortex parameters ######
+gamma = 1.4
+beta = 5.
+x0 = 0.
+y0 = 0.
+u0 = 1.
+v0 = 1.
+[]
+
+##############################################################################################
+#                                       FUNCTIONs                                            #
+##############################################################################################
+# Exact solution: initial conditions and reference for the L2 error.                         #
+##############################################################################################
+
+[Functions]
+  [./area]
+    type = ConstantFunction
+    value = 1.
+  [../]
+
+  [./rhoA_exact]
+    type = IsentropicVortexFunction
+    variable_name = RHOA
+  [../]
+
+  [./rhouA_exact]
+    type = IsentropicVortexFunction
+    variable_name = RHOUA_X
+  [../]
+
+  [./rhovA_exact]
+    type = IsentropicVortexFunction
+    variable_name = RHOUA_Y
+  [../]
+
+  [./rhoEA_exact]
+    type = IsentropicVortexFunction
+    variable_name = RHOEA
+  [../]
+[]
+
+#############################################################################
+#                          USER OBJECTS                                     #
+#############################################################################
+# Define the user object class that store the EOS parameters.               #
+#############################################################################
+
+[UserObjects]
+  [./eos]
+    type = StiffenedGasEquationOfState
+  	gamma = 1.4
+  	Pinf = 0.
+  	q = 0.
+  	Cv = 2.5
+  	q_prime = 0.
+  [../]
+[]
+
+###### Mesh #######
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 20
+  ny = 20
+  xmin = -10.
+  xmax = 10.
+  ymin = -10.
+  ymax = 10.
+  elem_type = QUAD9
+[]
+
+#############################################################################
+#                             VARIABLES                                     #
+#############################################################################
+# Second order Lagrange variables: they store the initial conditions and   #
+# the nodal values for the output, no kernel is needed.                     #
+#############################################################################
+
+[Variables]
+  [./rhoA]
+    order = SECOND
+    family = LAGRANGE
+	[./InitialCondition]
+        type = FunctionIC
+        function = rhoA_exact
+	[../]
+  [../]
+
+  [./rhouA]
+    order = SECOND
+    family = LAGRANGE
+	[./InitialCondition]
+        type = FunctionIC
+        function = rhouA_exact
+	[../]
+  [../]
+
+  [./rhovA]
+    order = SECOND
+    family = LAGRANGE
+    [./InitialCondition]
+        type = FunctionIC
+        function = rhovA_exact
+    [../]
+   [../]
+
+  [./rhoEA]
+    order = SECOND
+    family = LAGRANGE
+	[./InitialCondition]
+        type = FunctionIC
+        function = rhoEA_exact
+	[../]
+  [../]
+[]
+
+##############################################################################################
+#                                       AUXILARY VARIABLES                                   #
+##############################################################################################
+# Define the auxilary variables                                                              #
+##############################################################################################
+
+[AuxVariables]
+   [./area_aux]
+      order = SECOND
+      family = LAGRANGE
+   [../]
+
+   [./pressure_aux]
+      order = SECOND
+      family = LAGRANGE
+   [../]
+[]
+
+##############################################################################################
+#                                       AUXILARY KERNELS                                     #
+##############################################################################################
+# Define the auxilary kernels for liquid and gas phases. Same index as for variable block.   #
+##############################################################################################
+
+[AuxKernels]
+  [./AreaAK]
+    type = AreaAux
+    variable = area_aux
+    area = area
+  [../]
+
+  [./PressAK]
+    type = PressureAux
+    variable = pressure_aux
+    rhoA = rhoA
+    rhouA_x = rhouA
+    rhouA_y = rhovA
+    rhoEA = rhoEA
+    area = area_aux
+    eos = eos
+  [../]
+[]
+
+##############################################################################################
+#                                     EXECUTIONER                                            #
+##############################################################################################
+# The boundaries are kept at their initial state, far from the vortex.                       #
+##############################################################################################
+
+[Executioner]
+  type = EelSumFactorizedTransient
+  end_time = 1.
+  cfl = 0.3
+  output_interval = 100
+  eos = eos
+  entropy_viscosity = true
+  rhoA = rhoA
+  rhouA_x = rhouA
+  rhouA_y = rhovA
+  rhoEA = rhoEA
+  dirichlet_boundaries = 'left right top bottom'
+  exact_rhoA = rhoA_exact
+[]
+
+##############################################################################################
+#                                        OUTPUT                                              #
+##############################################################################################
+# Define the functions computing the inflow and outflow boundary conditions.                 #
+##############################################################################################
+
+[Output]
+  output_initial = true
+  postprocessor_screen = false
+  interval = 1
+  exodus = true
+  perf_log = true
+[]
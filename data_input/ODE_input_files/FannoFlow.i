@@ -13,17 +13,35 @@
   [./mach]
     family = SCALAR
     order = FIRST
-    initial_condition = 1
+    initial_condition = 0.5 # the source term is singular at M = 1
   [../]
 
 []
 
+[UserObjects]
+  [./eos]
+    type = EquationOfState
+    gamma = 2.35
+    Pinf = 1.e9
+    q = 0.
+    Cv = 1816
+    q_prime = 0
+  [../]
+[]
+
+# The time plays the role of the abscissa: d(mach)/dt + F(mach) = 0.
 [ScalarKernels]
+  [./machTime]
+    type = ODETimeDerivative
+    variable = mach
+  [../]
+
   [./machSK]
     type = RayleighFannoFlow
     variable = mach
     friction = 0.02
     Dh = 0.01
+    eos = eos
   [../]
 []
 
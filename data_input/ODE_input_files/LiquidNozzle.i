@@ -32,6 +32,15 @@
         type = ParsedFunction
         value = 0.5+x*0.5
     [../]
+
+    # Reference solution integrated with adaptive Runge-Kutta steps:
+    [./mach_reference]
+        type = FannoFlowSolution
+        mach_inlet = 0.5
+        friction = 0.02
+        Dh = 0.01
+        eos = eos
+    [../]
 []
 
 #############################################################################
@@ -80,12 +89,13 @@
     value = 0.5
     boundary = 'left'
   [../]
+[]
 
-  [./ContOutflowDBC]
-    type = DirichletBC
+[Postprocessors]
+  [./L1ErrorMach]
+    type = ElementL1Error
     variable = mach
-    value = 1
-    boundary = 'right'
+    function = mach_reference
   [../]
 []
 
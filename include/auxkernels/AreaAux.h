@@ -40,6 +40,12 @@ public:
 protected:
   virtual Real computeValue();
   Function & _area;
+
+  // The area does not depend on time: it is evaluated once per node and stored, indexed by node id.
+  // The position of the node is stored to detect the changes of the mesh.
+  std::vector<Real> _node_area;
+  std::vector<Point> _node_point;
+  std::vector<bool> _node_computed;
 };
 
 #endif //AREAAUX_H
@@ -24,11 +24,24 @@ public:
 
   virtual ~EelFluxBC(){}
 
+  // The boundary flux is computed with dual numbers once per quadrature point for the jacobian:
+  virtual void computeJacobian();
+  virtual void computeJacobianBlock(unsigned jvar);
+
 protected:
   virtual Real computeQpResidual();
   virtual Real computeQpJacobian();
   virtual Real computeQpOffDiagJacobian(unsigned jvar);
 
+    // Boundary flux evaluated with dual numbers: the derivatives times the test function are the entries of the jacobian matrix.
+    EelDualReal computeQpDualFlux();
+
+    // Computes the boundary flux with dual numbers at each quadrature point of the side:
+    void computeDualFluxes();
+    
+    // Returns the index of the coupled variable in the dual numbers (-1 if not coupled):
+    int conservativeIndex(unsigned jvar);
+
     enum EFlowEquationType
     {
     CONTINUITY = 0,
@@ -70,6 +83,9 @@ protected:
     unsigned int _rhouA_x_nb;
     unsigned int _rhouA_y_nb;
     unsigned int _rhoEA_nb;
+
+    // Boundary flux with its derivatives at the quadrature points (computed once per side for the jacobian):
+    std::vector<EelDualReal> _flux_dual;
 };
 
 #endif // EelFluxBC_H
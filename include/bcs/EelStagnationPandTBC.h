@@ -3,6 +3,7 @@
 
 #include "IntegratedBC.h"
 #include "EquationOfState.h"
+#include "EelSweepParameters.h"
 
 // Forward Declarations
 class EelStagnationPandTBC;
@@ -29,6 +30,12 @@ protected:
   virtual Real computeQpJacobian();
   virtual Real computeQpOffDiagJacobian(unsigned jvar);
 
+    // Computes rho_0, H_0, K and H_bar from the stagnation pressure and temperature:
+    void computeStagnationState();
+
+    // Reads p0_bc and T0_bc again when the variant of the parameter sweep changed:
+    void updateSweepParameters();
+
     enum EFlowEquationType
     {
     CONTINUITY = 1,
@@ -65,6 +72,10 @@ protected:
 
     // Equation of state:
     const EquationOfState & _eos;
+
+    // Parameter sweep and revision of the last update of p0_bc and T0_bc:
+    const EelSweepParameters * _sweep;
+    unsigned int _sweep_revision;
     
     // Parameters for jacobian matrix:
     unsigned int _rhoA_nb;
@@ -3,6 +3,7 @@
 
 #include "IntegratedBC.h"
 #include "EquationOfState.h"
+#include "EelSweepParameters.h"
 
 // Forward Declarations
 class EelStaticPandTBC;
@@ -19,11 +20,27 @@ public:
 
   virtual ~EelStaticPandTBC(){}
 
+  // The boundary flux is computed with dual numbers once per quadrature point for the jacobian:
+  virtual void computeJacobian();
+  virtual void computeJacobianBlock(unsigned jvar);
+
 protected:
   virtual Real computeQpResidual();
   virtual Real computeQpJacobian();
   virtual Real computeQpOffDiagJacobian(unsigned jvar);
 
+    // Boundary flux evaluated with dual numbers: the derivatives times the test function are the entries of the jacobian matrix.
+    EelDualReal computeQpDualFlux();
+
+    // Computes the boundary flux with dual numbers at each quadrature point of the side:
+    void computeDualFluxes();
+    
+    // Returns the index of the coupled variable in the dual numbers (-1 if not coupled):
+    int conservativeIndex(unsigned jvar);
+
+    // Reads p_bc and T_bc again when the variant of the parameter sweep changed:
+    void updateSweepParameters();
+
   enum EFlowEquationType
   {
     CONTINUITY = 0,
@@ -58,12 +75,19 @@ protected:
     
     // Equation of state
     const EquationOfState & _eos;
+
+    // Parameter sweep and revision of the last update of p_bc and T_bc:
+    const EelSweepParameters * _sweep;
+    unsigned int _sweep_revision;
     
     // Parameters for jacobian matrix:
     unsigned int _rhoA_nb;
     unsigned int _rhouA_x_nb;
     unsigned int _rhouA_y_nb;
     unsigned int _rhoEA_nb;
+
+    // Boundary flux with its derivatives at the quadrature points (computed once per side for the jacobian):
+    std::vector<EelDualReal> _flux_dual;
 };
 
 #endif // EELSTATICPANDTBC_H
@@ -0,0 +1,49 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef EELBLOCKJACOBITRANSIENT_H
+#define EELBLOCKJACOBITRANSIENT_H
+
+#include "Transient.h"
+#include "EelBlockJacobiPreconditioner.h"
+
+// Forward Declarations
+class EelBlockJacobiTransient;
+
+template<>
+InputParameters validParams<EelBlockJacobiTransient>();
+
+/**
+ * Transient executioner preconditioning the Krylov solver with the node-block Jacobi
+ * preconditioner, whose inverse blocks are stored in single precision if
+ * 'single_precision' is true (mixed precision: the Krylov solver and the application of
+ * the blocks are in double precision). The option '-pc_type' should not be set in the Preconditioning
+ * block since it would replace the shell preconditioner.
+ */
+class EelBlockJacobiTransient : public Transient
+{
+public:
+  EelBlockJacobiTransient(const std::string & name, InputParameters parameters);
+
+  virtual void takeStep(Real input_dt = -1.0);
+
+  virtual void postExecute();
+
+protected:
+  // Node-block Jacobi preconditioner:
+  EelBlockJacobiPreconditioner _preconditioner;
+};
+
+#endif // EELBLOCKJACOBITRANSIENT_H
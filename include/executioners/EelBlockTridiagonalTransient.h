@@ -0,0 +1,48 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef EELBLOCKTRIDIAGONALTRANSIENT_H
+#define EELBLOCKTRIDIAGONALTRANSIENT_H
+
+#include "Transient.h"
+#include "EelBlockTridiagonalSolver.h"
+
+// Forward Declarations
+class EelBlockTridiagonalTransient;
+
+template<>
+InputParameters validParams<EelBlockTridiagonalTransient>();
+
+/**
+ * Transient executioner for 1D runs: the linear systems of the Newton iterations are
+ * solved with the block Thomas algorithm instead of a general sparse preconditioner.
+ * The option '-pc_type' should not be set in the Preconditioning block since it would
+ * replace the block-tridiagonal solver.
+ */
+class EelBlockTridiagonalTransient : public Transient
+{
+public:
+  EelBlockTridiagonalTransient(const std::string & name, InputParameters parameters);
+
+  virtual void takeStep(Real input_dt = -1.0);
+
+protected:
+  // Use the factorization as a direct solver (no Krylov iteration):
+  bool _direct_solve;
+
+  // Block-tridiagonal solver:
+  EelBlockTridiagonalSolver _solver;
+};
+
+#endif // EELBLOCKTRIDIAGONALTRANSIENT_H
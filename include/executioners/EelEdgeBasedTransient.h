@@ -0,0 +1,78 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef EELEDGEBASEDTRANSIENT_H
+#define EELEDGEBASEDTRANSIENT_H
+
+#include "EelExplicitTransient.h"
+#include "EelEdgeGraph.h"
+
+// Forward Declarations
+class EelEdgeBasedTransient;
+class EelEdgeSolver;
+
+template<>
+InputParameters validParams<EelEdgeBasedTransient>();
+
+/**
+ * Explicit executioner assembling the Eel system on the node pairs of the mesh
+ * (EelEdgeGraph and EelEdgeSolver) instead of the quadrature loops of the kernels. The
+ * initial conditions are read from the nonlinear variables and the solution is copied
+ * back into them for the outputs. The kernels and boundary conditions of the input file
+ * are not used: the boundaries are either slip walls, Dirichlet boundaries kept at their
+ * initial state, or free (transmissive) boundaries. The graph is built again when the
+ * mesh is adapted. The first order scheme and the limited scheme keep the density and the
+ * internal energy positive for CFL numbers up to one.
+ */
+class EelEdgeBasedTransient : public EelExplicitTransient
+{
+public:
+  EelEdgeBasedTransient(const std::string & name, InputParameters parameters);
+  virtual ~EelEdgeBasedTransient();
+
+protected:
+  virtual void createSolver(const EquationOfState & eos);
+  virtual void build();
+  virtual bool isUpToDate();
+  virtual void storeDirichletStates();
+  virtual unsigned int numDofObjects();
+  virtual const DofObject & dofObject(unsigned int i);
+  virtual std::string variableType();
+  virtual std::vector<Real> & solution(unsigned int eq);
+  virtual Real computeTimeStep();
+  virtual void step(Real dt);
+  virtual void printStatistics(Real time, unsigned int t_step, unsigned int n_rebuilds, Real cpu_time);
+
+  // CFL number:
+  Real _cfl;
+
+  // Viscosity:
+  std::string _visc_name;
+  MooseEnum _visc_type;
+  bool _convex_limiting;
+
+  // Node-pair graph of the mesh:
+  EelEdgeGraph _graph;
+
+  // Edge-based solver:
+  EelEdgeSolver * _solver;
+
+  enum EViscosityType
+  {
+    FIRST_ORDER = 0,
+    SMOOTHNESS = 1
+  };
+};
+
+#endif // EELEDGEBASEDTRANSIENT_H
@@ -0,0 +1,66 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef EELENSEMBLETRANSIENT_H
+#define EELENSEMBLETRANSIENT_H
+
+#include "Executioner.h"
+
+// Forward Declarations
+class EelEnsembleTransient;
+
+template<>
+InputParameters validParams<EelEnsembleTransient>();
+
+/**
+ * Executioner running an ensemble of independent 1D pipes (EelPipeEnsemble) on the 1D
+ * mesh of the input file. The ensemble parameters are given as lists: a list with one
+ * value is used for all the instances. The solution of instance k is written in the
+ * file <file_base>_<k>.csv at the end of the run.
+ */
+class EelEnsembleTransient : public Executioner
+{
+public:
+  EelEnsembleTransient(const std::string & name, InputParameters parameters);
+
+  virtual void execute();
+
+protected:
+  // Returns the value of an ensemble parameter for instance k:
+  Real ensembleParam(const std::string & name, unsigned int k) const;
+
+  // Time parameters:
+  Real _cfl;
+  unsigned int _num_steps;
+
+  // Boundary conditions:
+  std::string _left_bc_name;
+  MooseEnum _left_bc_type;
+  std::string _right_bc_name;
+  MooseEnum _right_bc_type;
+
+  // Output:
+  std::string _file_base;
+
+  // Number of instances:
+  unsigned int _n_instances;
+
+  enum EBoundaryType
+  {
+    WALL = 0,
+    TRANSMISSIVE = 1
+  };
+};
+
+#endif // EELENSEMBLETRANSIENT_H
@@ -0,0 +1,91 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef EELEXPLICITTRANSIENT_H
+#define EELEXPLICITTRANSIENT_H
+
+#include "Executioner.h"
+
+// Forward Declarations
+class EelExplicitTransient;
+class EquationOfState;
+
+template<>
+InputParameters validParams<EelExplicitTransient>();
+
+/**
+ * Base class of the explicit executioners solving the Eel system outside of the kernels.
+ * The initial conditions are read from the nonlinear variables, the time loop advances the
+ * solver of the derived class, and the solution is copied back into the nonlinear variables
+ * for the outputs, after which the mesh is adapted. The derived class builds its operators
+ * again when the mesh changed. The initial state is kept in a vector of the nonlinear system,
+ * projected with the mesh, so that the Dirichlet boundaries keep their initial state through
+ * the adaptations.
+ */
+class EelExplicitTransient : public Executioner
+{
+public:
+  EelExplicitTransient(const std::string & name, InputParameters parameters);
+
+  virtual void execute();
+
+protected:
+  // Creates the solver and sets its boundary conditions:
+  virtual void createSolver(const EquationOfState & eos) = 0;
+
+  // Builds the operators of the solver for the current mesh, and tells whether they are up to date:
+  virtual void build() = 0;
+  virtual bool isUpToDate() = 0;
+
+  // Stores the state of the Dirichlet boundaries from the solution of the solver:
+  virtual void storeDirichletStates() = 0;
+
+  // Degrees of freedom of the solver (nodes or cells), their type and the solution of an equation:
+  virtual unsigned int numDofObjects() = 0;
+  virtual const DofObject & dofObject(unsigned int i) = 0;
+  virtual std::string variableType() = 0;
+  virtual std::vector<Real> & solution(unsigned int eq) = 0;
+
+  // Time step and update of the solver:
+  virtual Real computeTimeStep() = 0;
+  virtual void step(Real dt) = 0;
+
+  // Prints the cost of the solve at the end of the time loop:
+  virtual void printStatistics(Real time, unsigned int t_step, unsigned int n_rebuilds, Real cpu_time) = 0;
+
+  // Builds the operators for the current mesh and reads the Dirichlet states and the solution:
+  void setup();
+
+  // Copies a vector of the nonlinear system into the solver, and the solution of the solver back:
+  void readSolution(const NumericVector<Number> & vector);
+  void writeSolution();
+
+  // Writes the solution back into the nonlinear variables and outputs it:
+  void output(Real time, Real dt, int t_step);
+
+  // Time parameters:
+  Real _end_time;
+  unsigned int _num_steps;
+  unsigned int _output_interval;
+
+  // Variable numbers of rhoA, rhouA_x, rhouA_y, rhouA_z and rhoEA (-1 if not used):
+  std::vector<int> _var_nb;
+
+  // Boundaries:
+  std::set<BoundaryID> _wall_ids;
+  std::set<BoundaryID> _dirichlet_ids;
+};
+
+#endif // EELEXPLICITTRANSIENT_H
@@ -0,0 +1,77 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef EELFVTRANSIENT_H
+#define EELFVTRANSIENT_H
+
+#include "EelExplicitTransient.h"
+#include "EelFaceGeometry.h"
+
+// Forward Declarations
+class EelFVTransient;
+class EelFVSolver;
+
+template<>
+InputParameters validParams<EelFVTransient>();
+
+/**
+ * Explicit executioner solving the Eel system with the cell-centered finite volume scheme
+ * of EelFVSolver (HLLC fluxes, first order or MUSCL-Hancock). The variables are constant
+ * monomials: the initial conditions are read from the nonlinear variables and the solution
+ * is copied back into them for the outputs. The kernels and boundary conditions of the
+ * input file are not used: the boundaries are slip walls, Dirichlet boundaries kept at
+ * their initial state, static pressure and temperature boundaries (as EelStaticPandTBC),
+ * or free (transmissive) boundaries. The geometry is built again when the mesh is adapted.
+ */
+class EelFVTransient : public EelExplicitTransient
+{
+public:
+  EelFVTransient(const std::string & name, InputParameters parameters);
+  virtual ~EelFVTransient();
+
+protected:
+  virtual void createSolver(const EquationOfState & eos);
+  virtual void build();
+  virtual bool isUpToDate();
+  virtual void storeDirichletStates();
+  virtual unsigned int numDofObjects();
+  virtual const DofObject & dofObject(unsigned int i);
+  virtual std::string variableType();
+  virtual std::vector<Real> & solution(unsigned int eq);
+  virtual Real computeTimeStep();
+  virtual void step(Real dt);
+  virtual void printStatistics(Real time, unsigned int t_step, unsigned int n_rebuilds, Real cpu_time);
+
+  // CFL number:
+  Real _cfl;
+
+  // Scheme:
+  std::string _scheme_name;
+  MooseEnum _scheme_type;
+
+  // Cell and face geometry of the mesh:
+  EelFaceGeometry _geom;
+
+  // Finite volume solver:
+  EelFVSolver * _solver;
+
+  enum ESchemeType
+  {
+    FIRST_ORDER = 0,
+    MUSCL_HANCOCK = 1
+  };
+};
+
+#endif // EELFVTRANSIENT_H
@@ -0,0 +1,67 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef EELLAGGEDJACOBIANTRANSIENT_H
+#define EELLAGGEDJACOBIANTRANSIENT_H
+
+#include "Transient.h"
+
+#include <petscsnes.h>
+
+// Forward Declarations
+class EelLaggedJacobianTransient;
+
+template<>
+InputParameters validParams<EelLaggedJacobianTransient>();
+
+/**
+ * Transient executioner reusing the assembled preconditioning matrix (and its
+ * factorization) over several time steps. The matrix is rebuilt when it becomes
+ * older than 'max_jacobian_age' steps, or when the previous nonlinear solve shows
+ * that it is no longer a good approximation: too many linear iterations per Newton
+ * iteration, a poor Newton contraction rate or a failed solve.
+ */
+class EelLaggedJacobianTransient : public Transient
+{
+public:
+  EelLaggedJacobianTransient(const std::string & name, InputParameters parameters);
+
+  virtual void takeStep(Real input_dt = -1.0);
+
+  virtual void postExecute();
+
+protected:
+  // Updates the refresh flag from the statistics of the last nonlinear solve:
+  void checkLastSolve(SNES snes);
+
+  // Parameters:
+  int _max_jacobian_age;
+  Real _max_linear_its;
+  Real _max_contraction_rate;
+  bool _verbose_lag;
+
+  // Number of time steps since the last assembly of the preconditioning matrix:
+  int _jacobian_age;
+  // The preconditioning matrix has to be rebuilt at the next time step:
+  bool _refresh_next;
+
+  // Statistics reported at the end of the simulation:
+  unsigned int _n_assemblies;
+  unsigned int _n_nonlinear_its;
+
+  // Residual history of the last nonlinear solve:
+  std::vector<PetscReal> _residual_history;
+};
+
+#endif // EELLAGGEDJACOBIANTRANSIENT_H
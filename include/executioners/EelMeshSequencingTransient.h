@@ -0,0 +1,61 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef EELMESHSEQUENCINGTRANSIENT_H
+#define EELMESHSEQUENCINGTRANSIENT_H
+
+#include "Transient.h"
+
+// Forward Declarations
+class EelMeshSequencingTransient;
+
+template<>
+InputParameters validParams<EelMeshSequencingTransient>();
+
+/**
+ * Transient executioner starting the simulation on the input mesh and refining it
+ * uniformly 'num_refinements' times. The solution of each mesh is advanced until it is
+ * quasi-steady, i.e. until the relative change of the nonlinear variables per unit time
+ * is lower than 'sequence_tolerance', or for 'sequence_max_steps' time steps. The
+ * nonlinear and auxiliary variables (including the viscosity coefficients and the
+ * pressure and density used by the entropy residual) are then projected on the refined
+ * mesh, and the old and older states are set to the projected state: the BDF time
+ * derivative restarts from a steady state on the refined mesh.
+ */
+class EelMeshSequencingTransient : public Transient
+{
+public:
+  EelMeshSequencingTransient(const std::string & name, InputParameters parameters);
+
+  virtual void takeStep(Real input_dt = -1.0);
+
+protected:
+  // Relative change of the nonlinear variables per unit time during the last time step:
+  Real solutionChange();
+
+  // Refines the mesh and projects the solution:
+  void refine();
+
+  // Parameters:
+  unsigned int _num_refinements;
+  Real _sequence_tolerance;
+  unsigned int _sequence_max_steps;
+
+  // Current level of refinement and number of time steps on it:
+  unsigned int _level;
+  unsigned int _level_steps;
+};
+
+#endif // EELMESHSEQUENCINGTRANSIENT_H
@@ -0,0 +1,64 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef EELSUMFACTORIZEDTRANSIENT_H
+#define EELSUMFACTORIZEDTRANSIENT_H
+
+#include "EelExplicitTransient.h"
+
+// Forward Declarations
+class EelSumFactorizedTransient;
+class EelSumFactorizedSolver;
+
+template<>
+InputParameters validParams<EelSumFactorizedTransient>();
+
+/**
+ * Explicit executioner for the high order Lagrange elements (QUAD9, HEX27) evaluating the
+ * residual of the Eel system with sum factorization (EelSumFactorizedSolver), for smooth
+ * low Mach number problems. The first order elements are also supported to compare the
+ * two discretizations at the same number of unknowns. The initial conditions are read
+ * from the nonlinear variables and the solution is copied back into them for the outputs;
+ * the kernels of the input file are not used. If an exact density is supplied, the L2
+ * error of the density at the end time is printed with the number of nodes and the CPU
+ * time (convergence versus cost).
+ */
+class EelSumFactorizedTransient : public EelExplicitTransient
+{
+public:
+  EelSumFactorizedTransient(const std::string & name, InputParameters parameters);
+  virtual ~EelSumFactorizedTransient();
+
+protected:
+  virtual void createSolver(const EquationOfState & eos);
+  virtual void build();
+  virtual bool isUpToDate();
+  virtual void storeDirichletStates();
+  virtual unsigned int numDofObjects();
+  virtual const DofObject & dofObject(unsigned int i);
+  virtual std::string variableType();
+  virtual std::vector<Real> & solution(unsigned int eq);
+  virtual Real computeTimeStep();
+  virtual void step(Real dt);
+  virtual void printStatistics(Real time, unsigned int t_step, unsigned int n_rebuilds, Real cpu_time);
+
+  // CFL number:
+  Real _cfl;
+
+  // Sum-factorized solver:
+  EelSumFactorizedSolver * _solver;
+};
+
+#endif // EELSUMFACTORIZEDTRANSIENT_H
@@ -0,0 +1,58 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef EELSWEEPTRANSIENT_H
+#define EELSWEEPTRANSIENT_H
+
+#include "Transient.h"
+
+// Forward Declarations
+class EelSweepTransient;
+class EelSweepParameters;
+
+template<>
+InputParameters validParams<EelSweepTransient>();
+
+/**
+ * Transient executioner running the variants of a parameter sweep (EelSweepParameters)
+ * back to back in the same process: the application, the mesh, the degree of freedom maps
+ * and the sparsity patterns are built once. Before each variant, the parameters of the
+ * variant are set, the time is reset to the start time, the initial conditions are
+ * applied again and the outputs are written with the base name <file_base>_<k>. The
+ * solve time of each variant is reported at the end of the sweep.
+ */
+class EelSweepTransient : public Transient
+{
+public:
+  EelSweepTransient(const std::string & name, InputParameters parameters);
+
+  virtual void execute();
+
+protected:
+  // Resets the time and the time step for a new variant:
+  void resetTime();
+
+  // Parameter sweep:
+  const EelSweepParameters * _sweep;
+
+  // Output:
+  std::string _file_base;
+
+  // Start time and initial time step of each variant:
+  Real _sweep_start_time;
+  Real _sweep_dt;
+};
+
+#endif // EELSWEEPTRANSIENT_H
@@ -0,0 +1,69 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef EELCOMPILEDFUNCTION_H
+#define EELCOMPILEDFUNCTION_H
+
+#include "Function.h"
+#include "EelExpression.h"
+
+class EelCompiledFunction;
+
+template<>
+InputParameters validParams<EelCompiledFunction>();
+
+/**
+ * Function of x, y, z and t given by an expression, with the syntax and the parameters
+ * 'value', 'vars' and 'vals' of ParsedFunction (see EelExpression). The expression is
+ * translated into a C function, compiled into a shared library and loaded, so that the
+ * wall heat transfer, wall temperature, friction or area functions evaluated at every
+ * quadrature point cost a compiled function call instead of the interpretation of the
+ * expression. The libraries are kept in a cache directory under a hash of their source
+ * and of the compiler command: an expression is only compiled once, the next runs load
+ * the library. The processor 0 compiles the expression before the other processors load
+ * it. If the compilation or the loading fails, the expression tree is evaluated.
+ */
+class EelCompiledFunction : public Function
+{
+public:
+  EelCompiledFunction(const std::string & name, InputParameters parameters);
+  virtual ~EelCompiledFunction();
+
+  virtual Real value(Real t, const Point & p);
+
+protected:
+  // Returns the compiled function (NULL if the compilation or the loading failed):
+  typedef double (*CompiledExpression)(double, double, double, double, const double *);
+  CompiledExpression compile(const std::string & compiler, const std::string & cache_directory);
+
+  // Compiles the source into the library of the cache (false if the compilation failed):
+  static bool build(const std::string & source, const std::string & command, const std::string & cache_directory, const std::string & library);
+
+  // Returns the text quoted for the shell:
+  static std::string shellQuote(const std::string & text);
+
+  // Returns a 64-bit FNV-1a hash of a string:
+  static unsigned long long hash(const std::string & text);
+
+  // Expression and values of its constants:
+  EelExpression _expression;
+  std::vector<Real> _vals;
+
+  // Handle of the shared library and compiled function:
+  void * _library;
+  CompiledExpression _compiled;
+};
+
+#endif //EELCOMPILEDFUNCTION_H
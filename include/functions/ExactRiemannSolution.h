@@ -0,0 +1,91 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef EXACTRIEMANNSOLUTION_H
+#define EXACTRIEMANNSOLUTION_H
+
+#include "Function.h"
+#include "EquationOfState.h"
+#include "libmesh/threads.h"
+
+class ExactRiemannSolution;
+
+template<>
+InputParameters validParams<ExactRiemannSolution>();
+
+/**
+ * Exact solution (density, velocity or pressure) of the Riemann problem of the shock tubes
+ * for the stiffened gas equation of state 'eos'. The initial states are given by their
+ * pressure, velocity and temperature on each side of the membrane, as for the initial
+ * condition ConservativeVariables1DXIC. With p+Pinf in place of p, the stiffened gas
+ * behaves as an ideal gas of ratio gamma, and the star state is solved by the Newton
+ * iterations of the exact Riemann solver of Toro (chapter 4). The star state is computed
+ * once, at the first evaluation (the functions are built before the user objects); the
+ * solution at (x,t) is then sampled from the self-similar structure at (x-membrane)/t.
+ */
+class ExactRiemannSolution : public Function
+{
+public:
+  ExactRiemannSolution(const std::string & name, InputParameters parameters);
+
+  virtual Real value(Real t, const Point & p);
+
+protected:
+  // Solves the star pressure and velocity:
+  void computeStarState();
+
+  // Pressure function f_K(p) of the left or right wave, and its derivative:
+  void pressureFunction(Real p, Real rho_K, Real p_K, Real c_K, Real & f, Real & df) const;
+
+  // Density, velocity and pressure at x/t = s:
+  void sample(Real s, Real & rho, Real & vel, Real & pressure) const;
+
+  enum VariableType
+  {
+      DENSITY = 0,
+      VELOCITY = 1,
+      PRESSURE = 2
+  };
+
+  // Name of the variable the function will output.
+  std::string _var_name;
+  MooseEnum _var_type;
+
+  // Initial states (pressure, velocity and temperature) and position of the membrane:
+  Real _p_left;
+  Real _p_right;
+  Real _v_left;
+  Real _v_right;
+  Real _t_left;
+  Real _t_right;
+  Real _membrane;
+
+  // Equation of state parameters, densities and speeds of sound of the initial states:
+  Real _gamma;
+  Real _Pinf;
+  Real _rho_left;
+  Real _rho_right;
+  Real _c_left;
+  Real _c_right;
+
+  // Star state (the pressure is p+Pinf):
+  Real _p_star;
+  Real _v_star;
+  bool _star_computed;
+  // Lock of the lazy computation of the star state (the functions are shared by the threads):
+  Threads::spin_mutex _star_mutex;
+};
+
+#endif //EXACTRIEMANNSOLUTION_H
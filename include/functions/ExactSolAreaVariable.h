@@ -18,12 +18,22 @@
 #include "Function.h"
 #include "FunctionInterface.h"
 #include "EquationOfState.h"
+#include "libmesh/threads.h"
+#include "EelMonotoneSpline.h"
 
 class ExactSolAreaVariable;
 
 template<>
 InputParameters validParams<ExactSolAreaVariable>();
 
+/**
+ * Exact steady solution (density, velocity or pressure) of the subsonic flow in the nozzle
+ * of area A(x) = 1+0.5*cos(2*pi*x), for a stagnation state at the inlet and a static pressure
+ * at the outlet. The flow is isentropic for the stiffened gas equation of state 'eos'. The
+ * solution is computed once on 'num_points' abscissae, and the values at the quadrature
+ * points are interpolated with a monotone cubic spline. The functions are built before the
+ * user objects: the table is computed at the first evaluation.
+ */
 class ExactSolAreaVariable : public Function
 {
 public:
@@ -34,6 +44,12 @@ public:
   virtual RealVectorValue gradient(Real t, const Point & p);
 
 protected:
+    // Computes the table of the variable:
+    void computeTable();
+
+    // Returns the area at x:
+    Real area(Real x) const;
+
     enum VariableType
     {
         DENSITY = 0,
@@ -56,8 +72,14 @@ protected:
     // Length of the computational domain
     Real _length;
     
-    // Equation of state:
-//    const EquationOfState & _eos;
+    // Number of points of the table:
+    unsigned int _num_points;
+
+    // Interpolant of the variable (empty until the first evaluation):
+    EelMonotoneSpline _table;
+    bool _table_computed;
+    // Lock of the lazy computation of the table (the functions are shared by the threads):
+    Threads::spin_mutex _table_mutex;
 };
 
 #endif //EXACTSOLAREAVARIABLE_H
@@ -0,0 +1,79 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef FANNOFLOWSOLUTION_H
+#define FANNOFLOWSOLUTION_H
+
+#include "Function.h"
+#include "EquationOfState.h"
+#include "libmesh/threads.h"
+
+class FannoFlowSolution;
+
+template<>
+InputParameters validParams<FannoFlowSolution>();
+
+/**
+ * Reference Mach number profile of the Fanno flow modelled by EelFannoFlow and
+ * RayleighFannoFlow: dM/dx = -gamma*M^3*(1+0.5*(gamma-1)*M^2)*f/(Dh*(1-M^2)), with
+ * M(0) = 'mach_inlet'. The equation is integrated once, at the first evaluation (the
+ * functions are built before the user objects), with the embedded Runge-Kutta scheme of
+ * Dormand and Prince (orders 5 and 4) and an adaptive step controlled by the difference
+ * between the two orders. The Mach number and its derivative are stored at 'num_points'
+ * abscissae and interpolated with cubic Hermite polynomials.
+ */
+class FannoFlowSolution : public Function
+{
+public:
+  FannoFlowSolution(const std::string & name, InputParameters parameters);
+
+  virtual Real value(Real t, const Point & p);
+
+  virtual RealVectorValue gradient(Real t, const Point & p);
+
+protected:
+  // Integrates the equation and fills the table:
+  void computeTable();
+
+  // Right hand side dM/dx:
+  Real rhs(Real mach) const;
+
+  // Advances the Mach number from x to x+length with adaptive steps (h is the current step size):
+  void integrate(Real length, Real & mach, Real & h);
+
+  // Returns the index of the interval containing x and the position in the interval:
+  unsigned int interval(Real x, Real & s) const;
+
+  // Parameters of the flow:
+  Real _mach_inlet;
+  Real _f;
+  Real _Dh;
+  Real _length;
+  Real _gamma;
+
+  // Tolerances of the integration:
+  Real _rel_tol;
+  Real _abs_tol;
+
+  // Table of the Mach number and of its derivative:
+  unsigned int _num_points;
+  std::vector<Real> _mach;
+  std::vector<Real> _dmach;
+  bool _table_computed;
+  // Lock of the lazy computation of the table (the functions are shared by the threads):
+  Threads::spin_mutex _table_mutex;
+};
+
+#endif //FANNOFLOWSOLUTION_H
@@ -0,0 +1,67 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef ISENTROPICVORTEXFUNCTION_H
+#define ISENTROPICVORTEXFUNCTION_H
+
+#include "Function.h"
+
+class IsentropicVortexFunction;
+
+template<>
+InputParameters validParams<IsentropicVortexFunction>();
+
+/**
+ * Exact solution of the isentropic vortex for an ideal gas with the free stream state
+ * rho=1, p=1, advected by the free stream velocity (u0, v0):
+ *   T = 1 - (gamma-1) beta^2 / (8 gamma pi^2) exp(1-r^2),   rho = T^(1/(gamma-1)),   p = rho^gamma
+ *   (u, v) = (u0, v0) + beta/(2 pi) exp((1-r^2)/2) (-y, x)
+ * with r the distance to the center (x0+u0 t, y0+v0 t). The function returns one of the
+ * conservative variables and can be used as initial condition and as reference for the
+ * convergence studies.
+ */
+class IsentropicVortexFunction : public Function
+{
+public:
+  IsentropicVortexFunction(const std::string & name, InputParameters parameters);
+
+  virtual Real value(Real t, const Point & p);
+
+protected:
+    enum VariableType
+    {
+        RHOA = 0,
+        RHOUA_X = 1,
+        RHOUA_Y = 2,
+        RHOEA = 3
+    };
+
+    // Name of the variable the function will output.
+    std::string _var_name;
+
+    MooseEnum _var_type;
+
+    // Ratio of specific heats and strength of the vortex:
+    Real _gamma;
+    Real _beta;
+
+    // Initial center and free stream velocity:
+    Real _x0;
+    Real _y0;
+    Real _u0;
+    Real _v0;
+};
+
+#endif //ISENTROPICVORTEXFUNCTION_H
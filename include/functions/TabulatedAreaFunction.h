@@ -0,0 +1,54 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef TABULATEDAREAFUNCTION_H
+#define TABULATEDAREAFUNCTION_H
+
+#include "Function.h"
+#include "EelMonotoneSpline.h"
+
+class TabulatedAreaFunction;
+
+template<>
+InputParameters validParams<TabulatedAreaFunction>();
+
+/**
+ * Cross section A(x), or A(x,y), interpolated from a measured profile with monotone cubic
+ * splines (EelMonotoneSpline). The profile is given by the parameters 'x' and 'area', or
+ * by a file of two columns x and A. For a table A(x,y), 'area' lists the values of the
+ * rows y_0, y_1, ...: each row is interpolated in x, and the row values are interpolated
+ * in y. The splines are built once: the area is meant to be stored at the nodes by AreaAux,
+ * which evaluates the function once per node.
+ */
+class TabulatedAreaFunction : public Function
+{
+public:
+  TabulatedAreaFunction(const std::string & name, InputParameters parameters);
+
+  virtual Real value(Real t, const Point & p);
+
+  virtual RealVectorValue gradient(Real t, const Point & p);
+
+protected:
+  // Reads the columns x and A of the data file:
+  void readDataFile(const std::string & file_name, std::vector<Real> & x, std::vector<Real> & area) const;
+
+  // Splines of the rows (one row for a profile A(x)):
+  std::vector<EelMonotoneSpline> _rows;
+  // Ordinates of the rows:
+  std::vector<Real> _y;
+};
+
+#endif //TABULATEDAREAFUNCTION_H
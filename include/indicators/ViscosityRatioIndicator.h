@@ -0,0 +1,45 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef VISCOSITYRATIOINDICATOR_H
+#define VISCOSITYRATIOINDICATOR_H
+
+#include "ElementIndicator.h"
+
+class ViscosityRatioIndicator;
+
+template<>
+InputParameters validParams<ViscosityRatioIndicator>();
+
+/**
+ * Ratio mu/mu_max of the entropy viscosity to the first order viscosity. The ratio is
+ * close to one in the shocks and the contact discontinuities, where the entropy residual
+ * saturates the viscosity, and small where the solution is smooth. The largest value over
+ * the quadrature points of the element is stored.
+ */
+class ViscosityRatioIndicator : public ElementIndicator
+{
+public:
+  ViscosityRatioIndicator(const std::string & name, InputParameters parameters);
+  virtual ~ViscosityRatioIndicator(){};
+
+  virtual void computeIndicator();
+
+protected:
+  VariableValue & _mu;
+  VariableValue & _mu_max;
+};
+
+#endif /* VISCOSITYRATIOINDICATOR_H */
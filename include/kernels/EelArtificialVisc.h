@@ -16,6 +16,8 @@
 #define EELARTIFICIALVISC_H
 
 #include "Kernel.h"
+#include "EelDualNumber.h"
+#include "EelLoadBalance.h"
 
 // Forward Declarations
 class EelArtificialVisc;
@@ -30,6 +32,11 @@ public:
   EelArtificialVisc(const std::string & name,
              InputParameters parameters);
 
+  // The time spent on the element is measured when a load balance object is supplied:
+  virtual void computeResidual();
+  virtual void computeJacobian();
+  virtual void computeOffDiagJacobian( unsigned int jvar );
+
 protected:
 
   virtual Real computeQpResidual();
@@ -37,6 +44,12 @@ protected:
   virtual Real computeQpJacobian();
 
   virtual Real computeQpOffDiagJacobian(unsigned int _jvar);
+
+  /// Fluxes multiplying kappa and mu in the dissipative terms.
+  virtual void computeQpDissipativeFluxes(RealVectorValue & kappa_flux, RealVectorValue & mu_flux);
+
+  /// Contribution of the derivatives of mu and kappa with respect to the conservative variable 'index'.
+  virtual Real computeQpViscosityJacobian(unsigned int index);
     
 private:
     // Equations types
@@ -77,6 +90,18 @@ private:
     // Material property: viscosity coefficient.
     MaterialProperty<Real> & _mu;
     MaterialProperty<Real> & _kappa;
+    // Linearization of the viscosity coefficients:
+    bool _visc_jacobian;
+    MaterialProperty<EelDualReal> & _dmu_dU;
+    MaterialProperty<EelDualReal> & _dkappa_dU;
+    // Parameters for jacobian:
+    unsigned int _rhoA_nb;
+    unsigned int _rhouA_x_nb;
+    unsigned int _rhouA_y_nb;
+    unsigned int _rhouA_z_nb;
+    unsigned int _rhoEA_nb;
+    // Measure of the cost of the elements:
+    const EelLoadBalance * _load_balance;
 };
 
 #endif // EELARTIFICIALVISC_H
@@ -23,6 +23,10 @@ class EelCMethod;
 template<>
 InputParameters validParams<EelCMethod>();
 
+/**
+ * Residual of the auxiliary equation of the C-method, solved coupled with the Euler system.
+ * See EelCMethodSolver for the segregated solve of the same equation once per time step.
+ */
 class EelCMethod : public Kernel
 {
 public:
@@ -43,10 +47,10 @@ private:
     VariableGradient & _grad_press;
     // Parameter for diffusion term:
     double _kappa;
-    // Name of pps computing max(eigenvalues):
-    std::string _max_eig_pps_name;
-    // Name of pps computing max of ||grad(pressure)||
-    std::string _max_grad_press_pps_name;
+    // Value of the pps computing max(eigenvalues):
+    const PostprocessorValue & _Smax;
+    // Value of the pps computing max of ||grad(pressure)||
+    const PostprocessorValue & _gradP_max;
 };
 
 #endif // EELCMETHOD_H
@@ -17,6 +17,9 @@
 
 #include "Kernel.h"
 #include "EquationOfState.h"
+#include "EelDualNumber.h"
+#include "EelGroupFEMCache.h"
+#include "EelLoadBalance.h"
 #include "Function.h"
 
 // Forward Declarations
@@ -32,6 +35,12 @@ public:
   EelEnergy(const std::string & name,
              InputParameters parameters);
 
+  // The nodal fluxes of the group finite element formulation are computed once per element, and the
+  // time spent on the element is measured when a load balance object is supplied:
+  virtual void computeResidual();
+  virtual void computeJacobian();
+  virtual void computeOffDiagJacobian( unsigned int jvar );
+
 protected:
 
   virtual Real computeQpResidual();
@@ -41,6 +50,24 @@ protected:
   virtual Real computeQpOffDiagJacobian( unsigned int _jvar);
 
 private:
+    // Computes the convective flux and the source terms with dual numbers at each quadrature point of the element:
+    void computeDualTerms();
+
+    // Convective flux (three components stored in 'conv') and wall heat transfer plus gravity work at the quadrature point:
+    EelDualReal computeQpDualTerms( EelDualReal * conv );
+
+    // Jacobian entry with respect to the conservative variable 'index' built from the dual numbers of the quadrature point:
+    Real computeQpDualJacobian( unsigned int index );
+    
+    // Jacobian entry of the group finite element formulation with respect to the conservative variable 'index':
+    Real computeQpGroupJacobian( unsigned int index );
+
+    // Computes the nodal fluxes of the element and their interpolation at the quadrature points:
+    void computeGroupFluxes( bool with_derivatives );
+
+    // Returns the index of the coupled variable in the dual numbers (-1 if not coupled):
+    int conservativeIndex( unsigned int jvar );
+    
     // Coupled variables
     VariableValue & _rhoA;
     VariableValue & _rhouA_x;
@@ -50,12 +77,15 @@ private:
     VariableValue & _area;
     
     // Component:
-    std::string _Hw_fn_name;
-    std::string _Tw_fn_name;
+    // Wall heat transfer and wall temperature functions (NULL if the constant values are used):
+    Function * _Hw_fn;
+    Function * _Tw_fn;
     const Real & _Hw;
     const Real & _Tw;
     const Real & _aw;
     const RealVectorValue & _gravity;
+    // True if the wall heat transfer term is active (aw*Hw non zero):
+    bool _wall_heat_transfer;
     
     // Equation of state:
     const EquationOfState & _eos;
@@ -65,6 +95,23 @@ private:
     unsigned int _rhouA_x_nb;
     unsigned int _rhouA_y_nb;
     unsigned int _rhouA_z_nb;
+
+    // Group finite element formulation: nodal values, nodal fluxes rhouA*H and temperature with their
+    // derivatives, and interpolated values at the quadrature points.
+    bool _group_fem;
+    EelGroupFEMCache _group;
+    std::vector<EelDualReal> _nodal_flux;
+    std::vector<EelDualReal> _nodal_temp;
+    std::vector<RealVectorValue> _flux_qp;
+    std::vector<Real> _temp_qp;
+
+    // Dual numbers at the quadrature points (computed once per element for the jacobian): convective flux
+    // (three components per quadrature point) and wall heat transfer plus gravity work.
+    std::vector<EelDualReal> _flux_dual;
+    std::vector<EelDualReal> _sources_dual;
+
+    // Measure of the cost of the elements:
+    const EelLoadBalance * _load_balance;
 };
 
 #endif // EELENERGY_H
@@ -17,6 +17,7 @@
 
 #include "Kernel.h"
 #include "EquationOfState.h"
+#include "EelDualNumber.h"
 
 class EelFannoFlow;
 
@@ -37,6 +38,9 @@ protected:
 
   virtual Real computeQpOffDiagJacobian( unsigned int jvar );
 
+  // Friction source term evaluated with a dual number seeded on the Mach number:
+  EelDualNumber<1> computeSource( const EelDualNumber<1> & Mach );
+
 private:
     // Parameters:
     const Real & _f;
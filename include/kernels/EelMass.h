@@ -16,6 +16,7 @@
 #define EELMAS_H
 
 #include "Kernel.h"
+#include "EelLoadBalance.h"
 
 class EelMass;
 
@@ -28,6 +29,11 @@ public:
   EelMass(const std::string & name,
              InputParameters parameters);
 
+  // The time spent on the element is measured when a load balance object is supplied:
+  virtual void computeResidual();
+  virtual void computeJacobian();
+  virtual void computeOffDiagJacobian( unsigned int jvar );
+
 protected:
  
   virtual Real computeQpResidual();
@@ -46,6 +52,9 @@ private:
     unsigned int _rhouA_x_nb;
     unsigned int _rhouA_y_nb;
     unsigned int _rhouA_z_nb;
+
+    // Measure of the cost of the elements:
+    const EelLoadBalance * _load_balance;
 };
 
 #endif // EelMass_H
@@ -17,6 +17,9 @@
 
 #include "Kernel.h"
 #include "EquationOfState.h"
+#include "EelDualNumber.h"
+#include "EelGroupFEMCache.h"
+#include "EelLoadBalance.h"
 
 // Forward Declarations
 class EelMomentum;
@@ -31,6 +34,12 @@ public:
   EelMomentum(const std::string & name,
              InputParameters parameters);
 
+  // The nodal fluxes of the group finite element formulation are computed once per element, and the
+  // time spent on the element is measured when a load balance object is supplied:
+  virtual void computeResidual();
+  virtual void computeJacobian();
+  virtual void computeOffDiagJacobian( unsigned int jvar );
+
 protected:
 
   virtual Real computeQpResidual();
@@ -40,6 +49,24 @@ protected:
   virtual Real computeQpOffDiagJacobian( unsigned int jvar );
 
 private:
+    // Computes the flux vector, A*p and the source terms with dual numbers at each quadrature point of the element:
+    void computeDualTerms();
+
+    // Jacobian entry with respect to the conservative variable 'index' built from the dual numbers of the quadrature point:
+    Real computeQpDualJacobian( unsigned int index );
+    
+    // Friction and gravity terms evaluated with dual numbers:
+    EelDualReal computeQpDualSources();
+
+    // Jacobian entry of the group finite element formulation with respect to the conservative variable 'index':
+    Real computeQpGroupJacobian( unsigned int index );
+
+    // Computes the nodal fluxes of the element and their interpolation at the quadrature points:
+    void computeGroupFluxes( bool with_derivatives );
+
+    // Returns the index of the coupled variable in the dual numbers (-1 if not coupled):
+    int conservativeIndex( unsigned int jvar );
+    
     // Aux variables:
     VariableValue & _rhouA_x;
     VariableValue & _rhouA_y;
@@ -65,6 +92,24 @@ private:
     unsigned int _rhouA_y_nb;
     unsigned int _rhouA_z_nb;
     unsigned int _rhoEA_nb;
+
+    // Group finite element formulation: nodal values, nodal fluxes (rhouA*vel + A*p e) and A*p with their
+    // derivatives, and interpolated values at the quadrature points.
+    bool _group_fem;
+    EelGroupFEMCache _group;
+    std::vector<EelDualReal> _nodal_flux;
+    std::vector<EelDualReal> _nodal_Ap;
+    std::vector<RealVectorValue> _flux_qp;
+    std::vector<Real> _Ap_qp;
+
+    // Dual numbers at the quadrature points (computed once per element for the jacobian): flux vector
+    // (three components per quadrature point), A*p and friction plus gravity.
+    std::vector<EelDualReal> _flux_dual;
+    std::vector<EelDualReal> _Ap_dual;
+    std::vector<EelDualReal> _sources_dual;
+
+    // Measure of the cost of the elements:
+    const EelLoadBalance * _load_balance;
 };
 
 #endif // EELMOMENTUM_H
@@ -0,0 +1,68 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef SHOCKBANDMARKER_H
+#define SHOCKBANDMARKER_H
+
+#include "IndicatorMarker.h"
+
+#include <map>
+#include <algorithm>
+
+class ShockBandMarker;
+
+template<>
+InputParameters validParams<ShockBandMarker>();
+
+/**
+ * Marker refining a band of elements around the shocks and the contact discontinuities
+ * detected by an indicator in [0,1] (ViscosityRatioIndicator). An element is refined when
+ * the indicator exceeds 'refine_threshold' within 'band_width' layers of neighbors, and
+ * coarsened only when the indicator is below 'coarsen_threshold' within band_width+1 layers:
+ * between the two thresholds the element is left as it is, so that the elements behind a
+ * moving shock are not refined and coarsened at every adaptation. When the refinement
+ * would exceed 'max_elements' active elements, only the elements closest to the strongest
+ * discontinuities are refined: the elements of equal strength are ranked by their distance
+ * to the discontinuity (in layers) and then by their level. Only the local elements are scanned.
+ */
+class ShockBandMarker : public IndicatorMarker
+{
+public:
+  ShockBandMarker(const std::string & name, InputParameters parameters);
+  virtual ~ShockBandMarker(){};
+
+  virtual void markerSetup();
+
+protected:
+  virtual MarkerValue computeElementMarker();
+
+  // Largest indicator in each layer of neighbors of the element, up to band_width+1 layers:
+  void layerMaxima(const Elem * elem, std::vector<Real> & max_ratio) const;
+
+  // Applies the element budget to the elements marked for refinement (strength of the discontinuity
+  // and rank of the element among the elements of equal strength):
+  void applyBudget(const std::map<dof_id_type, Real> & strength, const std::map<dof_id_type, unsigned int> & rank);
+
+  Real _refine_threshold;
+  Real _coarsen_threshold;
+  unsigned int _band_width;
+  unsigned int _max_level;
+  unsigned int _max_elements;
+
+  // Marker of the local elements:
+  std::map<dof_id_type, MarkerValue> _marker;
+};
+
+#endif /* SHOCKBANDMARKER_H */
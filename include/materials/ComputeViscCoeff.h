@@ -4,6 +4,9 @@
 #include "Material.h"
 #include "MaterialProperty.h"
 #include "EquationOfState.h"
+#include "EelDualNumber.h"
+#include "EelLoadBalance.h"
+#include "EelSweepParameters.h"
 
 //Forward Declarations
 class ComputeViscCoeff;
@@ -16,9 +19,16 @@ class ComputeViscCoeff : public Material
 public:
   ComputeViscCoeff(const std::string & name, InputParameters parameters);
 
+  // The time spent on the element is measured when a load balance object is supplied, and
+  // the coefficients are read again when the variant of the parameter sweep changed:
+  virtual void computeProperties();
+
 protected:
   virtual void computeQpProperties();
 
+  /// Linearization of mu and kappa with respect to the conservative variables at the quadrature point.
+  virtual void computeQpViscosityJacobian(Real h, Real rhov2_pps);
+
 private:
     // Viscosity types
     enum ViscosityType
@@ -47,6 +57,9 @@ private:
     bool _isJumpOn;
     bool _isShock;
     
+    // Boolean for the linearization of the viscosity coefficients:
+    bool _visc_jacobian;
+    
     // Coupled aux variables: velocity
     VariableValue & _vel_x;
     VariableValue & _vel_y;
@@ -79,12 +92,21 @@ private:
     VariableValue & _area;
     VariableGradient & _grad_area;
     
+    // Coupled conservative variables: only used for the linearization of mu and kappa
+    VariableValue & _rhoA;
+    VariableValue & _rhouA_x;
+    VariableValue & _rhouA_y;
+    VariableValue & _rhouA_z;
+    VariableValue & _rhoEA;
+    
     // Material properties
     MaterialProperty<Real> & _mu;
     MaterialProperty<Real> & _mu_max;
     MaterialProperty<Real> & _kappa;
     MaterialProperty<Real> & _kappa_max;
     MaterialProperty<RealVectorValue> & _l;
+    MaterialProperty<EelDualReal> & _dmu_dU;
+    MaterialProperty<EelDualReal> & _dkappa_dU;
     
 //    MaterialProperty<Real> & _residual;
     // Wall heat transfer
@@ -106,6 +128,13 @@ private:
     std::string _rhov2_pps_name;
     std::string _rhoc2_pps_name;
     std::string _press_pps_name;
+
+    // Measure of the cost of the elements:
+    const EelLoadBalance * _load_balance;
+
+    // Parameter sweep and revision of the last update of Ce, Cjump, Cmax and isJumpOn:
+    const EelSweepParameters * _sweep;
+    unsigned int _sweep_revision;
 };
 
 #endif //ComputeViscCoeff_H
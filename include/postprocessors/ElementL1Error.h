@@ -26,6 +26,11 @@ class ElementL1Error;
 template<>
 InputParameters validParams<ElementL1Error>();
 
+/**
+ * L1 norm of the difference between a variable and a function. If 'error_times' is given,
+ * the integral is only computed at the time steps reaching these times, and the last value
+ * is returned at the other time steps.
+ */
 class ElementL1Error :
   public ElementIntegralVariablePostprocessor
   // public FunctionInterface
@@ -33,15 +38,29 @@ class ElementL1Error :
 public:
   ElementL1Error(const std::string & name, InputParameters parameters);
 
+  virtual void execute();
+
   /**
-   * Get the L2 Error.
+   * Get the L1 Error.
    */
   virtual Real getValue();
 
 protected:
   virtual Real computeQpIntegral();
 
+  // Returns the norm from the integral over the domain:
+  virtual Real norm(Real integral) const { return integral; }
+
+  // Returns true if the error is computed at the current time step:
+  bool isErrorTime() const;
+
   Function & _func;
+
+  // Times at which the error is computed (every time step if empty):
+  std::vector<Real> _error_times;
+
+  // Last computed error:
+  Real _error;
 };
 
 #endif //ElementL1Error_H
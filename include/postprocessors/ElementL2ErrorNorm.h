@@ -0,0 +1,43 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef ELEMENTL2ERRORNORM_H
+#define ELEMENTL2ERRORNORM_H
+
+#include "ElementL1Error.h"
+
+//Forward Declarations
+class ElementL2ErrorNorm;
+
+template<>
+InputParameters validParams<ElementL2ErrorNorm>();
+
+/**
+ * L2 norm of the difference between a variable and a function, computed at the times
+ * 'error_times' as ElementL1Error.
+ */
+class ElementL2ErrorNorm :
+  public ElementL1Error
+{
+public:
+  ElementL2ErrorNorm(const std::string & name, InputParameters parameters);
+
+protected:
+  virtual Real computeQpIntegral();
+
+  virtual Real norm(Real integral) const { return std::sqrt(integral); }
+};
+
+#endif //ELEMENTL2ERRORNORM_H
@@ -18,6 +18,7 @@
 
 #include "ODEKernel.h"
 #include "EquationOfState.h"
+#include "EelDualNumber.h"
 
 // Forward Declarations
 class RayleighFannoFlow;
@@ -38,6 +39,9 @@ protected:
 
     virtual Real computeQpOffDiagJacobian(unsigned int jvar);
 
+    // Residual evaluated with a dual number seeded on the Mach number:
+    EelDualNumber<1> computeDualResidual(const EelDualNumber<1> & Mach);
+
     // Friction parameter:
     const Real & _f;
     // Hydraulic parameter:
@@ -0,0 +1,91 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef EELCMETHODSOLVER_H
+#define EELCMETHODSOLVER_H
+
+#include "GeneralUserObject.h"
+#include "EelEdgeGraph.h"
+
+class EelCMethodSolver;
+
+template<>
+InputParameters validParams<EelCMethodSolver>();
+
+/**
+ * Segregated solve of the auxiliary equation of the C-method,
+ *   dC/dt + Smax/h C - div(Smax h kappa grad C) = Smax ||grad P|| / max ||grad P||,
+ * once per time step, for a first order Lagrange auxiliary variable C. With this object,
+ * C is not a nonlinear variable and the Jacobian of the Euler system only couples the
+ * conservative variables. The norm of the pressure gradient has all its components and
+ * its maximum is computed with the source term; the maximum eigenvalue Smax is read once
+ * per solve. The equation is discretized with linear elements and a lumped mass (backward
+ * Euler in time), on the node-pair graph of the mesh (EelEdgeGraph): the symmetric
+ * positive definite system is solved with the conjugate gradient method preconditioned
+ * by its diagonal. The mesh has to be serial: each processor solves the whole system.
+ */
+class EelCMethodSolver : public GeneralUserObject
+{
+public:
+  EelCMethodSolver(const std::string & name, InputParameters parameters);
+  virtual ~EelCMethodSolver();
+
+  virtual void initialize();
+  virtual void execute();
+  virtual void destroy();
+  virtual void finalize();
+  virtual void threadJoin(const UserObject & uo);
+
+protected:
+    // Builds the graph and the parts of the matrix that only depend on the mesh:
+    void assemble();
+
+    // Computes the source term from the pressure values (localized auxiliary solution):
+    void computeSource(const std::vector<Number> & values);
+
+    // y = A x with A = M/dt + Smax*(M_h + kappa*K_h):
+    void multiply(const std::vector<Real> & x, std::vector<Real> & y) const;
+
+    // Solves A x = b (x holds the initial guess), returns the number of iterations:
+    unsigned int solve(const std::vector<Real> & b, std::vector<Real> & x) const;
+
+    // Names of the variables:
+    std::string _c_name;
+    std::string _pressure_name;
+
+    // Parameters:
+    Real _kappa;
+    const PostprocessorValue & _Smax;
+    Real _l_tol;
+    unsigned int _l_max_its;
+
+    // Node-pair graph of the mesh:
+    EelEdgeGraph _graph;
+
+    // Lumped mass M, lumped mass divided by the element size M_h, diagonal and edge
+    // coefficients of the stiffness weighted by the element size K_h:
+    std::vector<Real> _mass;
+    std::vector<Real> _mass_h;
+    std::vector<Real> _stiffness_diag;
+    std::vector<Real> _stiffness_edge;
+
+    // Source term and diagonal of the current matrix:
+    std::vector<Real> _source;
+    std::vector<Real> _diagonal;
+    Real _dt_solve;
+    Real _Smax_solve;
+};
+
+#endif /* EELCMETHODSOLVER_H */
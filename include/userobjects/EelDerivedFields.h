@@ -0,0 +1,89 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef EELDERIVEDFIELDS_H
+#define EELDERIVEDFIELDS_H
+
+#include "GeneralUserObject.h"
+#include "EquationOfState.h"
+
+class EelDerivedFields;
+
+template<>
+InputParameters validParams<EelDerivedFields>();
+
+/**
+ * Computes output-only fields (density, velocity, pressure, energies, temperature, Mach
+ * number) from the conservative variables at the nodes, every 'interval' time steps, in
+ * place of a chain of auxiliary kernels executed at each time step. Set 'interval' to the
+ * interval of the outputs: between two outputs the fields are not computed. The fields are
+ * also computed from the initial conditions and at the end time of a transient, which are
+ * output whatever the interval. The fields
+ * are first order Lagrange auxiliary variables without kernel and without initial
+ * condition, that no kernel, material or postprocessor couples: a field needed at each
+ * time step keeps its auxiliary kernel. Each processor computes its local nodes.
+ */
+class EelDerivedFields : public GeneralUserObject
+{
+public:
+  EelDerivedFields(const std::string & name, InputParameters parameters);
+  virtual ~EelDerivedFields();
+
+  virtual void initialSetup();
+  virtual void initialize();
+  virtual void execute();
+  virtual void destroy();
+  virtual void finalize();
+  virtual void threadJoin(const UserObject & uo);
+
+protected:
+    // Computes the fields at the local nodes:
+    void computeFields();
+
+    // True if the current time step is the last one of the transient executioner:
+    bool lastStep();
+
+    // Value of a field at a node from the conservative variables (rhoA, rhouA, rhoEA) and the area:
+    Real computeField(unsigned int field, Real rhoA, const RealVectorValue & rhouA, Real rhoEA, Real area) const;
+
+    // Fields and auxiliary variables:
+    std::vector<unsigned int> _fields;
+    std::vector<AuxVariableName> _var_names;
+
+    // Names of the conservative variables (empty if not used):
+    std::vector<NonlinearVariableName> _cons_names;
+
+    // Equation of state:
+    const EquationOfState & _eos;
+
+    // Number of time steps between two evaluations:
+    unsigned int _interval;
+
+    enum EFieldType
+    {
+      DENSITY = 0,
+      VELOCITY_X = 1,
+      VELOCITY_Y = 2,
+      VELOCITY_Z = 3,
+      NORM_VELOCITY = 4,
+      PRESSURE = 5,
+      TOTAL_ENERGY = 6,
+      INTERNAL_ENERGY = 7,
+      TEMPERATURE = 8,
+      MACH_NUMBER = 9
+    };
+};
+
+#endif // EELDERIVEDFIELDS_H
@@ -0,0 +1,107 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef EELLOADBALANCE_H
+#define EELLOADBALANCE_H
+
+#include "GeneralUserObject.h"
+
+#include <time.h>
+
+class EelLoadBalance;
+
+template<>
+InputParameters validParams<EelLoadBalance>();
+
+/**
+ * Measures the time spent by the Eel kernels and materials on each element (see
+ * EelCostTimer) once every 'interval' time steps, and reports the load of the processors
+ * at the end of the sampled time step. When
+ * the slowest processor exceeds the average load by more than 'imbalance_tolerance', the
+ * mesh is partitioned again by Metis with the measured costs as element weights. The
+ * weighted partitioner is kept by the mesh, so that the partitions computed after the
+ * adaptation of the mesh are weighted too: the elements created since the last
+ * measurement have the average weight.
+ */
+class EelLoadBalance : public GeneralUserObject
+{
+public:
+  EelLoadBalance(const std::string & name, InputParameters parameters);
+  virtual ~EelLoadBalance();
+
+  virtual void initialize();
+  virtual void execute();
+  virtual void destroy();
+  virtual void finalize();
+  virtual void threadJoin(const UserObject & uo);
+
+  // True if the costs of the elements are measured during the current time step:
+  bool sampling() const { return _t_step > 0 && _t_step % _interval == 0; }
+
+  // Adds the time spent on an element. The elements are computed by one thread at a time.
+  void addCost(const Elem * elem, Real seconds) const;
+
+protected:
+    // Sets the element weights from the measured costs and partitions the mesh:
+    void repartition();
+
+    // Parameters:
+    unsigned int _interval;
+    Real _tolerance;
+    bool _repartition;
+
+    // Time spent on the local elements during the sampled time step, indexed by element id (filled by the kernels):
+    mutable std::vector<Real> _cost;
+
+    // Weights of the elements used by the partitioner of the mesh (average weight: 100):
+    ErrorVector _weights;
+    bool _weighted_partitioner;
+};
+
+/**
+ * Adds the CPU time of the calling thread between its construction and its destruction to
+ * the cost of an element. Nothing is measured without EelLoadBalance object, or outside of
+ * its sampled time steps.
+ */
+class EelCostTimer
+{
+public:
+  EelCostTimer(const EelLoadBalance * load_balance, const Elem * elem) :
+      _load_balance(load_balance && load_balance->sampling() ? load_balance : NULL),
+      _elem(elem),
+      _start(_load_balance ? threadTime() : 0.)
+  {}
+
+  ~EelCostTimer()
+  {
+      if (_load_balance)
+          _load_balance->addCost(_elem, threadTime() - _start);
+  }
+
+private:
+  // CPU time of the calling thread (std::clock sums the time of all the threads of the process):
+  static Real threadTime()
+  {
+      struct timespec ts;
+      clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+      return ts.tv_sec + 1.e-9*ts.tv_nsec;
+  }
+
+  const EelLoadBalance * _load_balance;
+  const Elem * _elem;
+  Real _start;
+};
+
+#endif /* EELLOADBALANCE_H */
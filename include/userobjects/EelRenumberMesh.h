@@ -0,0 +1,57 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef EELRENUMBERMESH_H
+#define EELRENUMBERMESH_H
+
+#include "GeneralUserObject.h"
+#include "EelSpaceFillingCurve.h"
+
+class EelRenumberMesh;
+
+template<>
+InputParameters validParams<EelRenumberMesh>();
+
+/**
+ * Renumbers the elements and the nodes of the mesh along a space-filling curve (see
+ * EelSpaceFillingCurve) at the first execution and each time the mesh changed since the
+ * last execution (uniform refinement, adaptivity). The solution is projected on the
+ * renumbered degrees of freedom. Executed at 'timestep_begin', the renumbering follows
+ * the adaptation of the previous time step.
+ */
+class EelRenumberMesh : public GeneralUserObject
+{
+public:
+  EelRenumberMesh(const std::string & name, InputParameters parameters);
+  virtual ~EelRenumberMesh();
+
+  virtual void initialize();
+  virtual void execute();
+  virtual void destroy();
+  virtual void finalize();
+  virtual void threadJoin(const UserObject & uo);
+
+protected:
+    // Space-filling curve:
+    std::string _curve_name;
+    MooseEnum _curve_type;
+
+    // Mesh signature after the last renumbering:
+    dof_id_type _n_elems;
+    dof_id_type _n_active_elems;
+    dof_id_type _n_nodes;
+};
+
+#endif /* EELRENUMBERMESH_H */
@@ -0,0 +1,73 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef EELSWEEPPARAMETERS_H
+#define EELSWEEPPARAMETERS_H
+
+#include "GeneralUserObject.h"
+
+class EelSweepParameters;
+
+template<>
+InputParameters validParams<EelSweepParameters>();
+
+/**
+ * Values of the swept parameters for each variant of a parameter sweep (EelSweepTransient).
+ * The objects taking a 'sweep' parameter (ComputeViscCoeff, EelStagnationPandTBC,
+ * EelStaticPandTBC) read the value of the current variant for the swept parameters and
+ * keep their input file value for the others. The variant is set by the executioner; the
+ * objects compare the revision with the one of their last update so that the values are
+ * read once per variant.
+ */
+class EelSweepParameters : public GeneralUserObject
+{
+public:
+  EelSweepParameters(const std::string & name, InputParameters parameters);
+  virtual ~EelSweepParameters();
+
+  virtual void initialize();
+  virtual void execute();
+  virtual void destroy();
+  virtual void finalize();
+  virtual void threadJoin(const UserObject & uo);
+
+  // Number of variants:
+  unsigned int numVariants() const { return _n_variants; }
+
+  // Sets the current variant (called by the executioner between two variants):
+  void setVariant(unsigned int k) const;
+
+  // Current variant and revision (incremented each time the variant is set):
+  unsigned int variant() const { return _variant; }
+  unsigned int revision() const { return _revision; }
+
+  // Value of a parameter for the current variant, or 'default_value' if the parameter is not swept:
+  Real value(const std::string & name, Real default_value) const;
+
+  // Description of the current variant ("Ce=1 Cjump=0.5"):
+  std::string description() const;
+
+protected:
+    // Names of the swept parameters and values, variant by variant:
+    std::vector<std::string> _names;
+    std::vector<Real> _values;
+    unsigned int _n_variants;
+
+    // Current variant and revision:
+    mutable unsigned int _variant;
+    mutable unsigned int _revision;
+};
+
+#endif // EELSWEEPPARAMETERS_H
@@ -2,6 +2,7 @@
 #define EQUATIONOFSTATE_H
 
 #include "GeneralUserObject.h"
+#include "EelDualNumber.h"
 
 // Forward Declarations
 class EquationOfState;
@@ -54,6 +55,19 @@ public:
     virtual Real dAp_drhouA(Real rhoA=0., Real rhouA_component=0., Real rhoEA=0.) const;
     
     virtual Real dAp_drhoEA(Real rhoA=0., Real rhouA_norm=0., Real rhoEA=0.) const;
+    
+    // Derivatives of the speed of sound squared:
+    virtual Real dc2_drho(Real rho=0., Real pressure=0.) const;
+    
+    virtual Real dc2_dp(Real rho=0., Real pressure=0.) const;
+    
+    // Derivatives of the temperature:
+    virtual Real dT_dp(Real pressure=0., Real rho=0.) const;
+    
+    virtual Real dT_drho(Real pressure=0., Real rho=0.) const;
+    
+    // Returns A*p with its derivatives with respect to the conservative variables (rhoA, rhouA_x, rhouA_y, rhouA_z, rhoEA):
+    EelDualReal Ap_dual(Real Ap, Real rhoA, const RealVectorValue & rhouA_vec, Real rhoEA) const;
 
     Real gamma() const;
     
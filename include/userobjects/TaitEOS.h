@@ -55,6 +55,11 @@ public:
     
     virtual Real dAp_drhoEA(Real rhoA=0., Real rhouA_norm=0., Real rhoEA=0.) const;
     
+    // Derivatives of the speed of sound squared:
+    virtual Real dc2_drho(Real rho=0., Real pressure=0.) const;
+    
+    virtual Real dc2_dp(Real rho=0., Real pressure=0.) const;
+    
 //  Real gamma() const { return _gamma; }
     
   Real P0() const { return _P0; }
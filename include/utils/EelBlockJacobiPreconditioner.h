@@ -0,0 +1,79 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef EELBLOCKJACOBIPRECONDITIONER_H
+#define EELBLOCKJACOBIPRECONDITIONER_H
+
+#include "Moose.h"
+
+#include <petscksp.h>
+
+// Forward Declarations
+class FEProblem;
+
+/**
+ * Node-block Jacobi preconditioner for first order Lagrange variables: the diagonal block
+ * of each node, which couples all the variables of the node, is inverted (LU with partial
+ * pivoting) and the inverse is stored, so that the application is a small dense product
+ * per node. The inverses can be stored in single precision: they are computed in double
+ * precision and rounded, and the products are accumulated in double precision, so that
+ * the Krylov solver only sees a slightly different preconditioner while the stored blocks
+ * take half the memory. Each processor inverts the blocks of its local nodes. The
+ * preconditioner is attached to the nonlinear solve as a PETSc shell preconditioner.
+ */
+class EelBlockJacobiPreconditioner
+{
+public:
+    EelBlockJacobiPreconditioner(FEProblem & problem, bool single_precision);
+
+    // Sets the preconditioner of the linear solver of the nonlinear solver:
+    void attach(SNES snes);
+
+    // Extracts the diagonal blocks of the matrix and inverts them:
+    void setup(Mat pmat);
+
+    // y = P^{-1}*x:
+    void apply(Vec x, Vec y);
+
+    // Memory used by the inverse blocks (bytes):
+    std::size_t blockMemory() const;
+
+    // PETSc callbacks:
+    static PetscErrorCode setupShell(PC pc);
+    static PetscErrorCode applyShell(PC pc, Vec x, Vec y);
+
+protected:
+    // Stores the local degrees of freedom of each local node:
+    void buildNodeBlocks();
+
+    FEProblem & _problem;
+
+    // Inverse blocks stored in single precision:
+    bool _single_precision;
+
+    // Number of variables (size of the blocks) and of local nodes:
+    unsigned int _n_vars;
+    unsigned int _n_nodes;
+
+    // First local degree of freedom and local degrees of freedom of the nodes: _dofs[i*_n_vars+v]
+    PetscInt _first_dof;
+    std::vector<PetscInt> _dofs;
+
+    // Inverse diagonal blocks (row major) in double or single precision:
+    std::vector<Real> _inverse;
+    std::vector<float> _inverse_single;
+};
+
+#endif // EELBLOCKJACOBIPRECONDITIONER_H
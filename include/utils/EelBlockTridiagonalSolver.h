@@ -0,0 +1,86 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef EELBLOCKTRIDIAGONALSOLVER_H
+#define EELBLOCKTRIDIAGONALSOLVER_H
+
+#include "Moose.h"
+
+#include <petscksp.h>
+
+// Forward Declarations
+class FEProblem;
+
+/**
+ * Direct solver for the jacobian matrix of a 1D problem discretized with first order
+ * Lagrange elements: the nodes are ordered along the line and the matrix is stored as
+ * a block-tridiagonal matrix whose blocks couple the variables of two neighboring nodes.
+ * The blocks are factorized with the block Thomas algorithm, so that both the setup and
+ * the solve are O(N). The solver is attached to the nonlinear solve as a PETSc shell
+ * preconditioner.
+ */
+class EelBlockTridiagonalSolver
+{
+public:
+    EelBlockTridiagonalSolver(FEProblem & problem);
+
+    // Sets the solver as the preconditioner of the nonlinear solver (and as the linear solver if 'direct_solve' is true):
+    void attach(SNES snes, bool direct_solve);
+
+    // Extracts the blocks of the preconditioning matrix and factorizes them (the operator 'amat' is only checked):
+    void setup(Mat amat, Mat pmat);
+
+    // Solves P*y = x:
+    void solve(Vec x, Vec y);
+
+    // PETSc callbacks:
+    static PetscErrorCode setupShell(PC pc);
+    static PetscErrorCode applyShell(PC pc, Vec x, Vec y);
+
+protected:
+    // Sorts the nodes along the line and stores the degrees of freedom of each node:
+    void buildNodeOrdering();
+
+    // LU factorization with partial pivoting of a dense m x m matrix (row major):
+    static void factorize(Real * a, int * pivots, unsigned int m);
+
+    // Solves a*x = b with a factorized matrix: b is overwritten with the solution.
+    static void backSubstitute(const Real * a, const int * pivots, Real * b, unsigned int m);
+
+    FEProblem & _problem;
+
+    // Number of variables (size of the blocks) and of nodes:
+    unsigned int _n_vars;
+    unsigned int _n_nodes;
+
+    // Degrees of freedom of the nodes ordered along the line: _dofs[i*_n_vars+v]
+    std::vector<PetscInt> _dofs;
+
+    // Position along the line of the node of each degree of freedom:
+    std::vector<unsigned int> _dof_nodes;
+
+    // True if the factorization replaces the linear solver:
+    bool _direct_solve;
+
+    // Blocks of the factorized matrix: lower blocks, factorized diagonal blocks and S^{-1}*upper blocks.
+    std::vector<Real> _lower;
+    std::vector<Real> _diag;
+    std::vector<Real> _upper;
+    std::vector<int> _pivots;
+
+    // Work vector used in the solve:
+    std::vector<Real> _work;
+};
+
+#endif // EELBLOCKTRIDIAGONALSOLVER_H
@@ -0,0 +1,199 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef EELDUALNUMBER_H
+#define EELDUALNUMBER_H
+
+#include "Moose.h"
+#include <cmath>
+
+/**
+ * Forward-mode dual number carrying a value and its derivatives with respect
+ * to N independent variables. The size is fixed at compile time so that no
+ * memory is allocated when evaluating a quadrature point.
+ */
+template<unsigned int N>
+class EelDualNumber
+{
+public:
+    EelDualNumber(Real value = 0.) :
+        _value(value)
+    {
+        for (unsigned int k=0; k<N; k++)
+            _deriv[k] = 0.;
+    }
+
+    // Returns an independent variable: its derivative with respect to itself is one.
+    static EelDualNumber variable(Real value, unsigned int index)
+    {
+        EelDualNumber x(value);
+        x._deriv[index] = 1.;
+        return x;
+    }
+
+    Real value() const { return _value; }
+    Real & value() { return _value; }
+
+    Real derivative(unsigned int index) const { return _deriv[index]; }
+    Real & derivative(unsigned int index) { return _deriv[index]; }
+
+    static unsigned int size() { return N; }
+
+    EelDualNumber & operator+=(const EelDualNumber & y)
+    {
+        _value += y._value;
+        for (unsigned int k=0; k<N; k++)
+            _deriv[k] += y._deriv[k];
+        return *this;
+    }
+
+    EelDualNumber & operator-=(const EelDualNumber & y)
+    {
+        _value -= y._value;
+        for (unsigned int k=0; k<N; k++)
+            _deriv[k] -= y._deriv[k];
+        return *this;
+    }
+
+    EelDualNumber & operator*=(const EelDualNumber & y)
+    {
+        for (unsigned int k=0; k<N; k++)
+            _deriv[k] = _deriv[k]*y._value + _value*y._deriv[k];
+        _value *= y._value;
+        return *this;
+    }
+
+    EelDualNumber & operator/=(const EelDualNumber & y)
+    {
+        Real inv = 1. / y._value;
+        for (unsigned int k=0; k<N; k++)
+            _deriv[k] = (_deriv[k] - _value*inv*y._deriv[k]) * inv;
+        _value *= inv;
+        return *this;
+    }
+
+    EelDualNumber & operator+=(Real y) { _value += y; return *this; }
+    EelDualNumber & operator-=(Real y) { _value -= y; return *this; }
+
+    EelDualNumber & operator*=(Real y)
+    {
+        _value *= y;
+        for (unsigned int k=0; k<N; k++)
+            _deriv[k] *= y;
+        return *this;
+    }
+
+    EelDualNumber & operator/=(Real y) { return (*this) *= 1./y; }
+
+    EelDualNumber operator-() const
+    {
+        EelDualNumber x(*this);
+        x *= -1.;
+        return x;
+    }
+
+    /**
+     * Applies the chain rule for a function f of this number:
+     * the value is replaced by f and the derivatives are scaled by df.
+     */
+    EelDualNumber compose(Real f, Real df) const
+    {
+        EelDualNumber x(f);
+        for (unsigned int k=0; k<N; k++)
+            x._deriv[k] = df*_deriv[k];
+        return x;
+    }
+
+private:
+    Real _value;
+    Real _deriv[N];
+};
+
+// Arithmetic operators:
+template<unsigned int N>
+inline EelDualNumber<N> operator+(EelDualNumber<N> x, const EelDualNumber<N> & y) { return x += y; }
+template<unsigned int N>
+inline EelDualNumber<N> operator-(EelDualNumber<N> x, const EelDualNumber<N> & y) { return x -= y; }
+template<unsigned int N>
+inline EelDualNumber<N> operator*(EelDualNumber<N> x, const EelDualNumber<N> & y) { return x *= y; }
+template<unsigned int N>
+inline EelDualNumber<N> operator/(EelDualNumber<N> x, const EelDualNumber<N> & y) { return x /= y; }
+
+template<unsigned int N>
+inline EelDualNumber<N> operator+(EelDualNumber<N> x, Real y) { return x += y; }
+template<unsigned int N>
+inline EelDualNumber<N> operator-(EelDualNumber<N> x, Real y) { return x -= y; }
+template<unsigned int N>
+inline EelDualNumber<N> operator*(EelDualNumber<N> x, Real y) { return x *= y; }
+template<unsigned int N>
+inline EelDualNumber<N> operator/(EelDualNumber<N> x, Real y) { return x /= y; }
+
+template<unsigned int N>
+inline EelDualNumber<N> operator+(Real x, EelDualNumber<N> y) { return y += x; }
+template<unsigned int N>
+inline EelDualNumber<N> operator-(Real x, const EelDualNumber<N> & y) { return EelDualNumber<N>(x) -= y; }
+template<unsigned int N>
+inline EelDualNumber<N> operator*(Real x, EelDualNumber<N> y) { return y *= x; }
+template<unsigned int N>
+inline EelDualNumber<N> operator/(Real x, const EelDualNumber<N> & y) { return EelDualNumber<N>(x) /= y; }
+
+// Comparisons only look at the value:
+template<unsigned int N>
+inline bool operator<(const EelDualNumber<N> & x, const EelDualNumber<N> & y) { return x.value() < y.value(); }
+template<unsigned int N>
+inline bool operator>(const EelDualNumber<N> & x, const EelDualNumber<N> & y) { return x.value() > y.value(); }
+
+// Elementary functions (found through argument-dependent lookup):
+template<unsigned int N>
+inline EelDualNumber<N> sqrt(const EelDualNumber<N> & x)
+{
+    Real f = std::sqrt(x.value());
+    // The derivative of sqrt is not defined at zero: return a zero slope instead of a NaN.
+    return x.compose(f, f > 0. ? 0.5/f : 0.);
+}
+
+template<unsigned int N>
+inline EelDualNumber<N> fabs(const EelDualNumber<N> & x)
+{
+    return x.compose(std::fabs(x.value()), x.value() < 0. ? -1. : 1.);
+}
+
+template<unsigned int N>
+inline EelDualNumber<N> pow(const EelDualNumber<N> & x, Real a)
+{
+    return x.compose(std::pow(x.value(), a), a*std::pow(x.value(), a-1.));
+}
+
+template<unsigned int N>
+inline EelDualNumber<N> max(const EelDualNumber<N> & x, const EelDualNumber<N> & y) { return x < y ? y : x; }
+template<unsigned int N>
+inline EelDualNumber<N> min(const EelDualNumber<N> & x, const EelDualNumber<N> & y) { return y < x ? y : x; }
+
+/**
+ * Dual number used for the Euler system: derivatives are taken with respect to
+ * the conservative variables rhoA, rhouA_x, rhouA_y, rhouA_z and rhoEA, in that order.
+ */
+enum EelConservativeIndex
+{
+    EEL_RHOA = 0,
+    EEL_RHOUA_X = 1,
+    EEL_RHOUA_Y = 2,
+    EEL_RHOUA_Z = 3,
+    EEL_RHOEA = 4,
+    EEL_NUM_CONSERVATIVE = 5
+};
+
+typedef EelDualNumber<EEL_NUM_CONSERVATIVE> EelDualReal;
+
+#endif // EELDUALNUMBER_H
@@ -0,0 +1,92 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef EELEDGEGRAPH_H
+#define EELEDGEGRAPH_H
+
+#include "Moose.h"
+
+#include <set>
+
+// Forward Declarations
+class MooseMesh;
+
+/**
+ * Node-pair graph of a mesh made of first order Lagrange elements. For linear elements,
+ * the Galerkin terms of the Euler equations only couple the nodes sharing an element,
+ * through the coefficients c_ij = int(phi_i grad phi_j) and the lumped mass
+ * m_i = int(phi_i). The graph stores each pair (i<j) once, sorted by i (compressed
+ * row storage of the upper triangle), with both c_ij and c_ji, so that the residual
+ * can be computed with one contiguous loop over the edges.
+ *
+ * The graph is built once per mesh: it has to be built again when the mesh changes,
+ * e.g. after adaptivity (see isUpToDate()).
+ */
+class EelEdgeGraph
+{
+public:
+    EelEdgeGraph();
+
+    // Builds the graph: the nodal normals are accumulated on the sides of the boundaries 'normal_boundaries'.
+    void build(MooseMesh & mesh, const std::set<BoundaryID> & normal_boundaries);
+
+    // Returns false if the mesh changed since the last build:
+    bool isUpToDate(MooseMesh & mesh) const;
+
+    unsigned int dimension() const { return _dim; }
+    unsigned int numNodes() const { return _nodes.size(); }
+    unsigned int numEdges() const { return _edge_i.size(); }
+
+    // Nodes in the local numbering:
+    const Node & node(unsigned int i) const { return *_nodes[i]; }
+    const std::vector<Real> & lumpedMass() const { return _lumped_mass; }
+
+    // Edges (i<j) and their coefficients:
+    const std::vector<unsigned int> & edgeI() const { return _edge_i; }
+    const std::vector<unsigned int> & edgeJ() const { return _edge_j; }
+    const std::vector<RealVectorValue> & cij() const { return _c_ij; }
+    const std::vector<RealVectorValue> & cji() const { return _c_ji; }
+
+    // First edge of each row (size numNodes()+1): the edges of row i are [rowStart(i), rowStart(i+1)).
+    const std::vector<unsigned int> & rowStart() const { return _row_start; }
+
+    // Integral of phi_i*n on the boundaries given to build() (zero for the other nodes):
+    const std::vector<RealVectorValue> & boundaryNormal() const { return _boundary_normal; }
+
+    // Local indices of the nodes lying on a set of boundaries:
+    std::vector<unsigned int> boundaryNodes(MooseMesh & mesh, const std::set<BoundaryID> & boundaries) const;
+
+protected:
+    unsigned int _dim;
+
+    // Mesh signature used to detect the changes of the mesh:
+    dof_id_type _n_mesh_nodes;
+    dof_id_type _n_mesh_elems;
+
+    // Nodes and map from the node id to the local index:
+    std::vector<const Node *> _nodes;
+    std::vector<int> _local_index;
+    std::vector<Real> _lumped_mass;
+
+    // Compressed node pairs:
+    std::vector<unsigned int> _row_start;
+    std::vector<unsigned int> _edge_i;
+    std::vector<unsigned int> _edge_j;
+    std::vector<RealVectorValue> _c_ij;
+    std::vector<RealVectorValue> _c_ji;
+
+    std::vector<RealVectorValue> _boundary_normal;
+};
+
+#endif // EELEDGEGRAPH_H
@@ -0,0 +1,142 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef EELEDGESOLVER_H
+#define EELEDGESOLVER_H
+
+#include "Moose.h"
+#include "EelDualNumber.h"
+
+// Forward Declarations
+class EelEdgeGraph;
+class EquationOfState;
+
+/**
+ * Explicit solver of the Eel system (rhoA, rhouA, rhoEA) assembled on the node pairs of
+ * an EelEdgeGraph. The state is stored structure-of-arrays in the local numbering of
+ * the graph. The equation of state is evaluated once per node and stage, and the
+ * Galerkin fluxes and the graph viscosity are computed in contiguous loops over the
+ * edges:
+ *   m_i dU_i/dt = - sum_j (F(U_j)-F(U_i)).c_ij + p_i sum_j (A_j-A_i) c_ij + sum_j d_ij (U_j-U_i)
+ * with d_ij = max(lambda_ij |c_ij|, lambda_ji |c_ji|) (first order graph viscosity). The wave
+ * speeds lambda_ij are upper bounds of the maximum wave speed of the Riemann problem between
+ * i and j for the stiffened gas, which makes the first order scheme invariant domain
+ * preserving (positive density and internal energy) for CFL numbers up to one.
+ * With the smoothness option, d_ij is scaled by the largest smoothness indicator of the
+ * nodes i and j, alpha_i = (|sum_j (rhoA_j-rhoA_i)| / sum_j |rhoA_j-rhoA_i|)^2, which is
+ * one at the extrema and at the odd-even oscillations and vanishes where the density is
+ * smooth. With convex limiting, the smoothness scheme is the high order scheme: the
+ * difference with the first order scheme is split into antidiffusive fluxes between the
+ * pairs of nodes, which are limited so that the density stays within the bounds given by
+ * the first order bar states and the specific entropy satisfies a local minimum
+ * principle. The time integration is the SSP-RK3 scheme.
+ */
+class EelEdgeSolver
+{
+public:
+    EelEdgeSolver(const EquationOfState & eos, bool smoothness_viscosity, bool convex_limiting);
+
+    // Sizes the arrays for the graph: the graph has to be set again after it is rebuilt.
+    void setGraph(const EelEdgeGraph & graph, const std::vector<Real> & area);
+
+    // Conservative variables (rhoA, rhouA_x, rhouA_y, rhouA_z, rhoEA) in the local numbering of the graph:
+    std::vector<Real> & solution(unsigned int eq) { return _U[eq]; }
+
+    // Boundary conditions: slip walls with the normals of the graph, and nodes kept at their current state.
+    void setWallNodes(const std::vector<unsigned int> & nodes);
+    void setDirichletNodes(const std::vector<unsigned int> & nodes);
+
+    // Computes the largest stable time step for a CFL number:
+    Real computeTimeStep(Real cfl);
+
+    // Advances the solution by one time step:
+    void step(Real dt);
+
+    // Time spent in the residual evaluation (seconds):
+    Real residualTime() const { return _residual_time; }
+
+protected:
+    // Computes the velocity, A*p and speed of sound at the nodes:
+    void computePrimitives(const std::vector<Real> * U);
+
+    // Computes the first order graph viscosity of the edges from the primitive variables:
+    void computeLowOrderViscosity();
+
+    // Computes the smoothness indicator of the nodes:
+    void computeSmoothness(const std::vector<Real> * U);
+
+    // Computes dU/dt:
+    void computeRHS(const std::vector<Real> * U, std::vector<Real> * rhs);
+
+    // Forward Euler step from U to U_new, with or without limiting:
+    void forwardEuler(const std::vector<Real> * U, Real dt, std::vector<Real> * U_new);
+
+    // Forward Euler step of the low order scheme corrected by the limited antidiffusive fluxes:
+    void limitedEuler(const std::vector<Real> * U, Real dt, std::vector<Real> * U_new);
+
+    // Returns the largest l in [0,1] such that U_low+l*P satisfies the bounds of the node i:
+    Real limiterCoefficient(const Real * U_low, const Real * P, unsigned int i) const;
+
+    // Returns (p+Pinf)/(gamma-1) - s_min*rho^gamma for the state U of the node i:
+    Real entropyConstraint(const Real * U, unsigned int i, Real s_min) const;
+
+    // Applies the wall and Dirichlet conditions to a state:
+    void applyBoundaryConditions(std::vector<Real> * U);
+
+    // Adds F(U_n).c to flux (one value per equation):
+    void addFlux(const std::vector<Real> * U, unsigned int n, const RealVectorValue & c, Real sign, Real * flux) const;
+
+    // Returns an upper bound of the maximum wave speed of the Riemann problem between the nodes i and j in the direction of c:
+    Real maxWaveSpeed(unsigned int i, unsigned int j, const RealVectorValue & c) const;
+
+    static const unsigned int _n_eqs = EEL_NUM_CONSERVATIVE;
+
+    const EquationOfState & _eos;
+    bool _smoothness_viscosity;
+    bool _convex_limiting;
+    const EelEdgeGraph * _graph;
+    std::vector<Real> _area;
+
+    // Conservative variables, stages and time derivatives:
+    std::vector<Real> _U[_n_eqs];
+    std::vector<Real> _U_stage[_n_eqs];
+    std::vector<Real> _U_euler[_n_eqs];
+    std::vector<Real> _rhs[_n_eqs];
+
+    // Primitive variables at the nodes:
+    std::vector<RealVectorValue> _vel;
+    std::vector<Real> _rho, _press, _pA, _c;
+
+    // Smoothness indicator of the nodes and sums over the rows used to compute it:
+    std::vector<Real> _alpha;
+    std::vector<Real> _diff_sum, _diff_abs;
+
+    // Graph viscosity of the edges and sum of each row:
+    std::vector<Real> _d_low;
+    std::vector<Real> _d_sum;
+
+    // Bounds of the limiter: density and specific entropy (p+Pinf)/rho^gamma.
+    std::vector<Real> _rhoA_min, _rhoA_max, _s_min;
+    std::vector<unsigned int> _n_neighbors;
+
+    // Boundary conditions:
+    std::vector<unsigned int> _wall_nodes;
+    std::vector<RealVectorValue> _wall_normals;
+    std::vector<unsigned int> _dirichlet_nodes;
+    std::vector<Real> _dirichlet_values;
+
+    Real _residual_time;
+};
+
+#endif // EELEDGESOLVER_H
@@ -0,0 +1,88 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef EELEXPRESSION_H
+#define EELEXPRESSION_H
+
+#include "Moose.h"
+
+/**
+ * Expression of the variables x, y, z, t and of named constants, with the syntax of the
+ * ParsedFunction expressions: + - * / ^, comparisons (< > <= >= = !=), & and |, the
+ * functions sin, cos, tan, asin, acos, atan, atan2, sinh, cosh, tanh, exp, log, log10,
+ * sqrt, abs, floor, ceil, pow, min, max, if(condition, a, b), and the constants pi and e.
+ * The expression is parsed once into a tree, which can be evaluated directly or
+ * translated into a C function (see EelCompiledFunction).
+ */
+class EelExpression
+{
+public:
+    EelExpression();
+
+    // Parses the expression: the names of the constants are given in the order of the values passed to evaluate().
+    void parse(const std::string & expression, const std::vector<std::string> & constants);
+
+    // Evaluates the tree:
+    Real evaluate(Real x, Real y, Real z, Real t, const std::vector<Real> & constants) const;
+
+    // Source of the C function 'double name(double x, double y, double z, double t, const double * c)':
+    std::string cSource(const std::string & name) const;
+
+protected:
+    enum EOperator
+    {
+        NUMBER, VARIABLE, CONSTANT,
+        ADD, SUB, MUL, DIV, POW, NEG, NOT,
+        LT, GT, LE, GE, EQ, NE, AND, OR,
+        IF, MIN, MAX, ATAN2,
+        SIN, COS, TAN, ASIN, ACOS, ATAN, SINH, COSH, TANH, EXP, LOG, LOG10, SQRT, ABS, FLOOR, CEIL
+    };
+
+    struct ExpressionNode
+    {
+        EOperator op;
+        Real value;
+        unsigned int index;
+        std::vector<unsigned int> args;
+    };
+
+    // Recursive descent parser: each level returns the index of the node it created.
+    unsigned int parseOr();
+    unsigned int parseAnd();
+    unsigned int parseComparison();
+    unsigned int parseSum();
+    unsigned int parseProduct();
+    unsigned int parseUnary();
+    unsigned int parsePower();
+    unsigned int parsePrimary();
+
+    unsigned int addNode(EOperator op, unsigned int a = 0, unsigned int b = 0, unsigned int n_args = 0);
+    void skipSpaces();
+    bool accept(const std::string & token);
+    void parseError(const std::string & message) const;
+
+    Real evaluateNode(unsigned int n, const Real * variables, const std::vector<Real> & constants) const;
+    std::string cNode(unsigned int n) const;
+
+    std::string _expression;
+    std::vector<std::string> _constants;
+    std::vector<ExpressionNode> _nodes;
+    unsigned int _root;
+
+    // Position of the parser in the expression:
+    unsigned int _pos;
+};
+
+#endif // EELEXPRESSION_H
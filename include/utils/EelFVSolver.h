@@ -0,0 +1,169 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef EELFVSOLVER_H
+#define EELFVSOLVER_H
+
+#include "Moose.h"
+#include "EelDualNumber.h"
+
+#include <map>
+
+// Forward Declarations
+class EelFaceGeometry;
+class EquationOfState;
+
+/**
+ * Explicit cell-centered finite volume solver of the Eel system (rhoA, rhouA, rhoEA) on
+ * an EelFaceGeometry. The state is stored structure-of-arrays in the local numbering of
+ * the cells and the residual is computed with one loop over the interior faces and one
+ * loop over the boundary faces:
+ *   V_i d(U_i)/dt = - sum_f A_f F_hllc(W_L, W_R).S_f + p_i sum_f A_f S_f
+ * where the last term is the area source of the momentum equation (it vanishes when the
+ * area is constant). The numerical flux is the HLLC flux with the wave speed estimates of
+ * Davis, written with the pressure so that it holds for any equation of state.
+ *
+ * With the second order option, the scheme is the MUSCL-Hancock scheme: the gradients of
+ * the primitive variables (rho, u, v, w, p) are computed by least squares and limited
+ * with the limiter of Barth and Jespersen, the cell states are advanced by half a time
+ * step with the primitive form of the equations, and the face states are extrapolated
+ * from the centroids. A cell whose face states have a negative density or an imaginary
+ * speed of sound falls back to the first order scheme.
+ *
+ * The boundary conditions follow the ones of the kernels: free (transmissive), slip wall
+ * (mirror state, only the pressure contributes to the flux as with EelWallBC), state kept
+ * at its initial value, and static pressure and temperature (same inflow and outflow
+ * states as EelStaticPandTBC).
+ *
+ * With the quiescent masking, the cells whose conservative state changed by more than a
+ * tolerance during the last step are flagged, and the flags are expanded by the width of
+ * the stencil (one layer of neighbors for the first order scheme, two for MUSCL-Hancock):
+ * the cells outside of this region are frozen, and the faces between two such cells and the
+ * gradients away from the region are not computed. The masked region follows the waves since
+ * they cross at most one cell per step for CFL numbers up to one. With a zero tolerance, only
+ * the cells of an unchanged neighborhood are skipped: their time derivative would be zero, so
+ * that the scheme stays conservative.
+ */
+class EelFVSolver
+{
+public:
+    EelFVSolver(const EquationOfState & eos, bool second_order);
+
+    enum EBoundaryType
+    {
+        FREE = 0,
+        WALL = 1,
+        DIRICHLET = 2,
+        STATIC_PANDT = 3
+    };
+
+    // Sizes the arrays for the geometry: the geometry has to be set again after it is rebuilt.
+    // The area is given at the cells, interior faces and boundary faces.
+    void setGeometry(const EelFaceGeometry & geom, const std::vector<Real> & cell_area, const std::vector<Real> & face_area, const std::vector<Real> & bface_area);
+
+    // Conservative variables (rhoA, rhouA_x, rhouA_y, rhouA_z, rhoEA) in the local numbering of the cells:
+    std::vector<Real> & solution(unsigned int eq) { return _U[eq]; }
+
+    // Boundary condition of a boundary (the boundaries without condition are free). The Dirichlet
+    // faces keep the state of their cell when the geometry is set.
+    void setBoundaryCondition(BoundaryID id, EBoundaryType type, Real p_bc=0., Real T_bc=0., Real gamma_bc=0.);
+
+    // Stores the current cell states as the states of the Dirichlet faces:
+    void storeDirichletStates();
+
+    // Freezes the cells whose neighborhood changed by less than tolerance*max|U| during the last step:
+    void setQuiescentMasking(bool masking, Real tolerance);
+
+    // Fraction of the cell updates skipped in the frozen cells:
+    Real skippedFraction() const { return _n_cell_updates > 0 ? Real(_n_skipped)/_n_cell_updates : 0.; }
+
+    // Computes the largest stable time step for a CFL number:
+    Real computeTimeStep(Real cfl);
+
+    // Advances the solution by one time step:
+    void step(Real dt);
+
+    // Time spent in the residual evaluation (seconds):
+    Real residualTime() const { return _residual_time; }
+
+protected:
+    // Computes the primitive variables of the cells:
+    void computePrimitives();
+
+    // Computes the limited least-squares gradients of the primitive variables:
+    void computeGradients();
+
+    // Advances the primitive variables by dt/2 (Hancock predictor) and checks the face states:
+    void predictor(Real dt);
+
+    // Primitive state of the cell i extrapolated at the point centroid+dx:
+    void faceState(unsigned int i, const RealVectorValue & dx, Real * W) const;
+
+    // Boundary state of the face bf from the interior state W:
+    void boundaryState(unsigned int bf, const Real * W, Real * W_bc) const;
+
+    // Computes the HLLC flux through the area vector S (from the state W_L to the state W_R):
+    void hllcFlux(const Real * W_L, const Real * W_R, const RealVectorValue & S, Real * flux) const;
+
+    // Physical flux of the state W through the area vector S:
+    void physicalFlux(const Real * W, const RealVectorValue & S, Real * flux) const;
+
+    // Total energy per unit volume of a primitive state:
+    Real totalEnergy(const Real * W) const;
+
+    // Flags the cells that changed during the step and the cells whose time derivative depends on them:
+    void updateActiveCells(Real dt);
+
+    // Number of conservative variables, and of primitive variables (rho, u, v, w, p) stored with the same indices:
+    static const unsigned int _n_eqs = EEL_NUM_CONSERVATIVE;
+
+    const EquationOfState & _eos;
+    bool _second_order;
+    const EelFaceGeometry * _geom;
+    std::vector<Real> _area, _face_area, _bface_area;
+
+    // Conservative variables and time derivatives:
+    std::vector<Real> _U[_n_eqs];
+    std::vector<Real> _rhs[_n_eqs];
+
+    // Primitive variables at time n and n+1/2, gradients:
+    std::vector<Real> _W[_n_eqs];
+    std::vector<Real> _W_half[_n_eqs];
+    std::vector<RealVectorValue> _grad[_n_eqs];
+    std::vector<Real> _c;
+
+    // Work arrays of the limiter and of the time step:
+    std::vector<Real> _W_min, _W_max, _limiter;
+    std::vector<bool> _first_order;
+    std::vector<Real> _lambda_sum;
+
+    // Quiescent masking: cells changed during the last step, cells whose time derivative is computed and
+    // cells whose gradient is computed.
+    bool _masking;
+    Real _mask_tolerance;
+    std::vector<bool> _changed, _active, _stencil;
+    unsigned long _n_cell_updates, _n_skipped;
+
+    // Boundary conditions of the boundaries and of the boundary faces:
+    std::map<BoundaryID, unsigned int> _bc_index;
+    std::vector<EBoundaryType> _bc_type;
+    std::vector<Real> _bc_p, _bc_T, _bc_gamma;
+    std::vector<int> _bface_bc;
+    std::vector<Real> _dirichlet_values;
+
+    Real _residual_time;
+};
+
+#endif // EELFVSOLVER_H
@@ -0,0 +1,101 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef EELFACEGEOMETRY_H
+#define EELFACEGEOMETRY_H
+
+#include "Moose.h"
+
+// Forward Declarations
+class MooseMesh;
+
+/**
+ * Cell and face geometry of a mesh for the cell-centered finite volume scheme
+ * (EelFVSolver). The active elements are the cells: their volume, centroid and the
+ * inverse of the least-squares matrix sum_f d_f d_f^T used to compute the gradients are
+ * computed once. Each interior face is stored once with its two cells, its area vector
+ * S_f = |f| n_f (oriented from the left cell to the right cell), its centroid and the
+ * vectors from the two centroids to the face centroid. Faces between elements of
+ * different levels (adapted meshes) are the sides of the finer element. The boundary
+ * faces are stored with their cell and boundary id.
+ *
+ * The geometry is built once per mesh: it has to be built again when the mesh changes,
+ * e.g. after adaptivity (see isUpToDate()).
+ */
+class EelFaceGeometry
+{
+public:
+    EelFaceGeometry();
+
+    void build(MooseMesh & mesh);
+
+    // Returns false if the mesh changed since the last build:
+    bool isUpToDate(MooseMesh & mesh) const;
+
+    unsigned int dimension() const { return _dim; }
+    unsigned int numCells() const { return _cells.size(); }
+    unsigned int numFaces() const { return _face_left.size(); }
+    unsigned int numBoundaryFaces() const { return _bface_cell.size(); }
+
+    // Cells in the local numbering:
+    const Elem & cell(unsigned int i) const { return *_cells[i]; }
+    const std::vector<Real> & cellVolume() const { return _volume; }
+    const std::vector<Point> & cellCentroid() const { return _centroid; }
+    const std::vector<RealTensorValue> & leastSquaresInverse() const { return _lsq_inverse; }
+
+    // Interior faces:
+    const std::vector<unsigned int> & faceLeft() const { return _face_left; }
+    const std::vector<unsigned int> & faceRight() const { return _face_right; }
+    const std::vector<RealVectorValue> & faceArea() const { return _face_area; }
+    const std::vector<Point> & faceCentroid() const { return _face_centroid; }
+    const std::vector<RealVectorValue> & faceLeftOffset() const { return _face_dx_left; }
+    const std::vector<RealVectorValue> & faceRightOffset() const { return _face_dx_right; }
+
+    // Boundary faces (the area vectors point outward):
+    const std::vector<unsigned int> & boundaryFaceCell() const { return _bface_cell; }
+    const std::vector<BoundaryID> & boundaryFaceId() const { return _bface_id; }
+    const std::vector<RealVectorValue> & boundaryFaceArea() const { return _bface_area; }
+    const std::vector<Point> & boundaryFaceCentroid() const { return _bface_centroid; }
+    const std::vector<RealVectorValue> & boundaryFaceOffset() const { return _bface_dx; }
+
+protected:
+    unsigned int _dim;
+
+    // Mesh signature used to detect the changes of the mesh:
+    dof_id_type _n_mesh_nodes;
+    dof_id_type _n_mesh_elems;
+
+    // Cells and map from the element id to the local index:
+    std::vector<const Elem *> _cells;
+    std::vector<int> _local_index;
+    std::vector<Real> _volume;
+    std::vector<Point> _centroid;
+    std::vector<RealTensorValue> _lsq_inverse;
+
+    std::vector<unsigned int> _face_left;
+    std::vector<unsigned int> _face_right;
+    std::vector<RealVectorValue> _face_area;
+    std::vector<Point> _face_centroid;
+    std::vector<RealVectorValue> _face_dx_left;
+    std::vector<RealVectorValue> _face_dx_right;
+
+    std::vector<unsigned int> _bface_cell;
+    std::vector<BoundaryID> _bface_id;
+    std::vector<RealVectorValue> _bface_area;
+    std::vector<Point> _bface_centroid;
+    std::vector<RealVectorValue> _bface_dx;
+};
+
+#endif // EELFACEGEOMETRY_H
@@ -0,0 +1,76 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef EELGROUPFEMCACHE_H
+#define EELGROUPFEMCACHE_H
+
+#include "Moose.h"
+#include "EelDualNumber.h"
+
+// Forward Declarations
+class EquationOfState;
+class SystemBase;
+
+/**
+ * Nodal values of the current element used by the group finite element formulation of
+ * the kernels: the fluxes are computed at the nodes and interpolated with the shape
+ * functions, F_h = sum_j F(U_j) phi_j, instead of being evaluated with the interpolated
+ * state at each quadrature point. The conservative variables are read from the nonlinear
+ * system, and the pressure and the area from the auxiliary system (the pressure is the
+ * nodal value computed by PressureAux). The derivatives of A*p with respect to the
+ * conservative variables are cached in a nodal vector: the equation of state is called
+ * once per node and Newton iterate, and not for each pair of shape functions at each
+ * quadrature point. The Jacobian entries of the node j only depend on the state of the
+ * node j (linear in the degrees of freedom).
+ */
+class EelGroupFEMCache
+{
+public:
+    EelGroupFEMCache(const EquationOfState & eos);
+
+    // Sets the numbers of rhoA, rhouA_x, rhouA_y, rhouA_z and rhoEA in the nonlinear system (-1 if not coupled)
+    // and of the pressure and the area in the auxiliary system.
+    void setVariables(const std::vector<int> & var_nb, unsigned int pressure_nb, unsigned int area_nb);
+
+    // Reads the nodal values of the element:
+    void reinit(const Elem * elem, SystemBase & nl, SystemBase & aux);
+
+    unsigned int numNodes() const { return _n_nodes; }
+    Real conservative(unsigned int k, unsigned int eq) const { return _U[k*EEL_NUM_CONSERVATIVE+eq]; }
+    Real pressure(unsigned int k) const { return _press[k]; }
+    Real area(unsigned int k) const { return _area[k]; }
+
+    // A*p at the node k with its derivatives with respect to the conservative variables of the node:
+    EelDualReal ApDual(unsigned int k);
+
+protected:
+    const EquationOfState & _eos;
+    std::vector<int> _var_nb;
+    unsigned int _pressure_nb;
+    unsigned int _area_nb;
+
+    // Nodal values of the current element:
+    unsigned int _n_nodes;
+    std::vector<dof_id_type> _node_id;
+    std::vector<Real> _U;
+    std::vector<Real> _press;
+    std::vector<Real> _area;
+
+    // Derivatives of A*p and state at which they were computed, indexed by the node id:
+    std::vector<EelDualReal> _cached_Ap;
+    std::vector<Real> _cached_U;
+};
+
+#endif // EELGROUPFEMCACHE_H
@@ -0,0 +1,49 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef EELMONOTONESPLINE_H
+#define EELMONOTONESPLINE_H
+
+#include "Moose.h"
+
+/**
+ * Monotone piecewise cubic Hermite interpolant of tabulated data (Fritsch-Carlson
+ * slopes): the interpolant is monotone where the data is monotone, and has no overshoot
+ * at the extrema of the data. The slopes are computed once by setData(). Outside the
+ * table the first and last values are extended (zero derivative).
+ */
+class EelMonotoneSpline
+{
+public:
+    EelMonotoneSpline();
+
+    // Sets the data: the abscissae have to be strictly increasing.
+    void setData(const std::vector<Real> & x, const std::vector<Real> & y);
+
+    Real value(Real x) const;
+    Real derivative(Real x) const;
+
+    const std::vector<Real> & abscissae() const { return _x; }
+
+protected:
+    // Returns the interval [x_k, x_k+1] containing x:
+    unsigned int interval(Real x) const;
+
+    std::vector<Real> _x;
+    std::vector<Real> _y;
+    std::vector<Real> _slope;
+};
+
+#endif // EELMONOTONESPLINE_H
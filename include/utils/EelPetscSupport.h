@@ -0,0 +1,34 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef EELPETSCSUPPORT_H
+#define EELPETSCSUPPORT_H
+
+#include "Moose.h"
+
+#include <petscsnes.h>
+
+// Forward Declarations
+class FEProblem;
+
+namespace EelPetscSupport
+{
+    /**
+     * Returns the PETSc nonlinear solver of the nonlinear system. The SNES object is
+     * initialized if the first solve did not happen yet, so that options can be set on it.
+     */
+    SNES getSNES(FEProblem & problem);
+}
+
+#endif // EELPETSCSUPPORT_H
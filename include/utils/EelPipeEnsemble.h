@@ -0,0 +1,99 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef EELPIPEENSEMBLE_H
+#define EELPIPEENSEMBLE_H
+
+#include "Moose.h"
+
+/**
+ * Ensemble of independent 1D pipes sharing the same mesh and area, advanced together
+ * in time. Each instance has its own stiffened gas parameters, entropy viscosity
+ * coefficients and initial Riemann problem. The data is stored structure-of-arrays with
+ * the instance index running fastest, so that the loops over the instances are
+ * contiguous and can be vectorized by the compiler.
+ *
+ * The discretization is the 1D version of the Eel one: linear continuous finite
+ * elements with a lumped mass matrix, the parabolic entropy viscosity (kappa on all
+ * equations) and an explicit SSP-RK2 time integration with a time step per instance.
+ */
+class EelPipeEnsemble
+{
+public:
+    EelPipeEnsemble(const std::vector<Real> & x, const std::vector<Real> & area, unsigned int n_instances);
+
+    unsigned int size() const { return _n_inst; }
+
+    // Per-instance parameters:
+    void setEquationOfState(unsigned int k, Real gamma, Real Pinf, Real q, Real Cv);
+    void setViscosity(unsigned int k, Real Ce, Real Cjump, Real Cmax);
+    void setRiemannProblem(unsigned int k, Real membrane, Real p_left, Real vel_left, Real temp_left, Real p_right, Real vel_right, Real temp_right);
+    void setEndTime(unsigned int k, Real end_time);
+
+    // Boundary conditions shared by all the instances (wall or transmissive):
+    void setBoundaryConditions(bool left_wall, bool right_wall);
+
+    // Computes the time step of each instance from the CFL condition: the instances that reached their end time get a zero time step.
+    void computeTimeSteps(Real cfl);
+
+    // Advances all the instances by one time step:
+    void step();
+
+    // Returns true when all the instances reached their end time:
+    bool finished() const;
+
+    Real time(unsigned int k) const { return _time[k]; }
+
+    // Writes the solution of instance k: x, area, rho, vel, pressure, rhoA, rhouA, rhoEA.
+    void writeCSV(unsigned int k, const std::string & file_name) const;
+
+protected:
+    // Computes the density, velocity, pressure and speed of sound squared at the nodes:
+    void computePrimitives(const std::vector<Real> * U);
+
+    // Computes the entropy viscosity coefficient of each element from the current and previous solutions:
+    void computeViscosity();
+
+    // Computes the time derivative of the conservative variables:
+    void computeRHS(const std::vector<Real> * U, std::vector<Real> * rhs);
+
+    // Mesh and area (shared):
+    unsigned int _n_nodes;
+    unsigned int _n_inst;
+    std::vector<Real> _x;
+    std::vector<Real> _area;
+    std::vector<Real> _lumped_mass;
+    bool _left_wall;
+    bool _right_wall;
+
+    // Per-instance parameters:
+    std::vector<Real> _gamma, _Pinf, _q, _Cv;
+    std::vector<Real> _Ce, _Cjump, _Cmax;
+    std::vector<Real> _end_time, _time, _dt, _dt_old;
+    unsigned int _t_step;
+
+    // Conservative variables (rhoA, rhouA, rhoEA) and stages of the time integration: index i*_n_inst+k
+    std::vector<Real> _U[3];
+    std::vector<Real> _U_stage[3];
+    std::vector<Real> _rhs[3];
+
+    // Primitive variables at the nodes, and density and pressure at the previous time step:
+    std::vector<Real> _rho, _vel, _press, _c2;
+    std::vector<Real> _rho_old, _press_old;
+
+    // Viscosity coefficient of each element: index e*_n_inst+k
+    std::vector<Real> _kappa;
+};
+
+#endif // EELPIPEENSEMBLE_H
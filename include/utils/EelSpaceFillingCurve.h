@@ -0,0 +1,51 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef EELSPACEFILLINGCURVE_H
+#define EELSPACEFILLINGCURVE_H
+
+#include "Moose.h"
+
+/**
+ * Renumbering of the elements and nodes of a serial mesh along a space-filling curve, so
+ * that the elements and nodes close in space are close in memory. The degrees of freedom
+ * are distributed by libMesh in the order of the elements: they follow the curve too,
+ * which reduces the bandwidth of the matrices and the cache misses of the loops over the
+ * elements and their sides.
+ */
+namespace EelSpaceFillingCurve
+{
+    enum ECurveType
+    {
+        HILBERT = 0,
+        MORTON = 1
+    };
+
+    /**
+     * Key of the point p on the curve through a grid of 2^16 cells per direction covering the
+     * box [p_min, p_max]. The Hilbert curve is used in 2D (consecutive cells are neighbors),
+     * the Morton curve in 3D and for the MORTON option.
+     */
+    unsigned long long key(const Point & p, const Point & p_min, const Point & p_max, unsigned int dim, ECurveType curve);
+
+    /**
+     * Renumbers the elements in the order of the keys of their centroids, and the nodes in
+     * the order in which the active elements use them. The sets of element and node ids
+     * are not changed.
+     */
+    void renumber(MeshBase & mesh, ECurveType curve);
+}
+
+#endif // EELSPACEFILLINGCURVE_H
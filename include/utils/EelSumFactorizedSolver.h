@@ -0,0 +1,177 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef EELSUMFACTORIZEDSOLVER_H
+#define EELSUMFACTORIZEDSOLVER_H
+
+#include "Moose.h"
+#include "EelDualNumber.h"
+#include "EelTensorProductBasis.h"
+
+#include <set>
+
+// Forward Declarations
+class MooseMesh;
+class EquationOfState;
+
+/**
+ * Explicit solver of the Eel system (rhoA, rhouA, rhoEA with a unit area) for tensor-product
+ * Lagrange elements (EDGE3, QUAD9 and HEX27 for the second order, and the first order
+ * elements) evaluated with sum factorization (EelTensorProductBasis). The residual
+ *   R_i(U) = sum_e int (F(U) - kappa_e grad(U)).grad(phi_i) - int_boundary phi_i F_b(U).n
+ * is computed element by element without any matrix: the nodal values are interpolated to
+ * the quadrature points one direction at a time, the fluxes are evaluated at the
+ * quadrature points with the cached metric terms w*det(J)*J^-1, and the result is tested
+ * against the gradients of the shape functions with the transposed 1D operators.
+ * computeResidual() is the matrix-free action of the operator.
+ *
+ * The lumped mass preconditions a few Jacobi iterations on the consistent mass matrix,
+ * whose action is also computed with sum factorization: with the lumped mass alone, the
+ * dispersion error of the second order elements is about twice as large. The entropy viscosity
+ * kappa_e is constant per element, computed once per time step from the residual of the
+ * entropy equation written with the pressure and the density (as in ComputeViscCoeff,
+ * without the jump term), Dp/Dt - c^2 Drho/Dt, with the length h_e = hmin/p, and bounded
+ * by the first order viscosity Cmax h_e (|u|+c). The time integration is the SSP-RK3 scheme.
+ */
+class EelSumFactorizedSolver
+{
+public:
+    EelSumFactorizedSolver(const EquationOfState & eos, bool entropy_viscosity, Real Ce, Real Cmax, unsigned int mass_iterations);
+
+    // Builds the operators of the mesh: the walls are the sides of the boundaries 'wall_boundaries'.
+    void build(MooseMesh & mesh, const std::set<BoundaryID> & wall_boundaries);
+
+    // Returns false if the mesh changed since the last build:
+    bool isUpToDate(MooseMesh & mesh) const;
+
+    unsigned int degree() const { return _basis.degree(); }
+    unsigned int numNodes() const { return _nodes.size(); }
+    unsigned int numElems() const { return _n_elems; }
+    const Node & node(unsigned int i) const { return *_nodes[i]; }
+
+    // Conservative variables (rhoA, rhouA_x, rhouA_y, rhouA_z, rhoEA) in the local numbering of the nodes:
+    std::vector<Real> & solution(unsigned int eq) { return _U[eq]; }
+
+    // Local indices of the nodes lying on a set of boundaries:
+    std::vector<unsigned int> boundaryNodes(MooseMesh & mesh, const std::set<BoundaryID> & boundaries) const;
+
+    // Nodes kept at their current state:
+    void setDirichletNodes(const std::vector<unsigned int> & nodes);
+
+    // Computes the viscosity and the largest stable time step for a CFL number:
+    Real computeTimeStep(Real cfl);
+
+    // Advances the solution by one time step:
+    void step(Real dt);
+
+    // Matrix-free action of the operator: R = residual of U (without the mass matrix).
+    void computeResidual(const std::vector<Real> * U, std::vector<Real> * R);
+
+    // Density at the quadrature points, with their coordinates and weights w*det(J):
+    void densityAtPoints(std::vector<Real> & rho_q) const;
+    const std::vector<Point> & quadraturePoints() const { return _x_q; }
+    const std::vector<Real> & quadratureWeights() const { return _wdetJ; }
+
+    // Time spent in the residual evaluation (seconds) and number of evaluations:
+    Real residualTime() const { return _residual_time; }
+    unsigned int numResiduals() const { return _n_residuals; }
+
+protected:
+    // Computes the entropy viscosity of the elements and the maximum wave speeds:
+    void computeViscosity();
+
+    // Computes the pressure at the nodes:
+    void computeNodalPressure(const std::vector<Real> * U, std::vector<Real> & press) const;
+
+    // Forward Euler step from U to U_new:
+    void forwardEuler(const std::vector<Real> * U, Real dt, std::vector<Real> * U_new);
+
+    // Matrix-free product with the consistent mass matrix:
+    void applyMass(const std::vector<Real> * U, std::vector<Real> * MU);
+
+    // Applies the wall and Dirichlet conditions to a state:
+    void applyBoundaryConditions(std::vector<Real> * U);
+
+    static const unsigned int _n_eqs = EEL_NUM_CONSERVATIVE;
+
+    const EquationOfState & _eos;
+    bool _entropy_viscosity;
+    Real _Ce;
+    Real _Cmax;
+    unsigned int _mass_iterations;
+
+    EelTensorProductBasis _basis;
+    unsigned int _dim;
+
+    // Mesh signature used to detect the changes of the mesh:
+    dof_id_type _n_mesh_nodes;
+    dof_id_type _n_mesh_elems;
+
+    // Nodes and map from the node id to the local index:
+    std::vector<const Node *> _nodes;
+    std::vector<int> _local_index;
+    std::vector<Real> _lumped_mass;
+
+    // Nodes of the elements in lexicographic order, and length h_e = hmin/p:
+    unsigned int _n_elems;
+    std::vector<unsigned int> _elem_nodes;
+    std::vector<Real> _h;
+
+    // Metric terms at the quadrature points: w*det(J), J^-1 (dxi_a/dx_b, stored a*3+b) and coordinates.
+    std::vector<Real> _wdetJ;
+    std::vector<Real> _inv_jac;
+    std::vector<Point> _x_q;
+
+    // Boundary sides: element nodes on the side, shape functions and JxW*n at the face quadrature points.
+    unsigned int _n_face_points;
+    std::vector<bool> _side_wall;
+    std::vector<unsigned int> _side_start;
+    std::vector<unsigned int> _side_node;
+    std::vector<Real> _side_phi;
+    std::vector<RealVectorValue> _side_normal;
+
+    // Conservative variables, stages and residuals:
+    std::vector<Real> _U[_n_eqs];
+    std::vector<Real> _U_stage[_n_eqs];
+    std::vector<Real> _U_euler[_n_eqs];
+    std::vector<Real> _R[_n_eqs];
+    std::vector<Real> _dUdt[_n_eqs];
+    std::vector<Real> _MdU[_n_eqs];
+
+    // Viscosity and maximum wave speed of the elements, density and pressure of the previous step:
+    std::vector<Real> _kappa;
+    std::vector<Real> _lambda;
+    std::vector<Real> _rho_old, _press_old, _press;
+    Real _dt_old;
+
+    // Boundary conditions:
+    std::vector<unsigned int> _wall_nodes;
+    std::vector<RealVectorValue> _wall_normals;
+    std::vector<unsigned int> _dirichlet_nodes;
+    std::vector<Real> _dirichlet_values;
+
+    // Work arrays of an element, one block per equation: nodal values, values and reference gradients
+    // at the quadrature points, fluxes mapped to the reference element and residual.
+    std::vector<Real> _U_e;
+    std::vector<Real> _U_q;
+    std::vector<Real> _dU_q[3];
+    std::vector<Real> _G_q[3];
+    std::vector<Real> _R_e;
+
+    Real _residual_time;
+    unsigned int _n_residuals;
+};
+
+#endif // EELSUMFACTORIZEDSOLVER_H
@@ -0,0 +1,89 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef EELTENSORPRODUCTBASIS_H
+#define EELTENSORPRODUCTBASIS_H
+
+#include "Moose.h"
+
+/**
+ * One-dimensional Lagrange basis of degree p (equispaced nodes on [-1,1], as the libMesh
+ * Lagrange elements) evaluated at the p+1 Gauss points, and the sum-factorized operators
+ * of the tensor-product elements (EDGE, QUAD and HEX). The values at the nodes of an
+ * element are stored in lexicographic order (first direction fastest). Interpolating to
+ * the quadrature points or integrating against the test functions is done one direction
+ * at a time, which costs O((p+1)^(d+1)) per element instead of O((p+1)^(2d)) for the
+ * loops over the shape functions and the quadrature points. Several fields stored one
+ * after the other (e.g. the conservative variables) are processed in one pass.
+ */
+class EelTensorProductBasis
+{
+public:
+    EelTensorProductBasis();
+
+    // Builds the 1D matrices for the degree p (1 to 3) and the dimension dim:
+    void init(unsigned int p, unsigned int dim);
+
+    unsigned int degree() const { return _p; }
+    unsigned int dimension() const { return _dim; }
+    unsigned int numNodes1D() const { return _n_nodes; }
+    unsigned int numPoints1D() const { return _n_points; }
+    unsigned int numNodes() const { return _n_nodes_elem; }
+    unsigned int numPoints() const { return _n_points_elem; }
+
+    // Reference coordinates of the nodes and of the Gauss points, and Gauss weights:
+    const std::vector<Real> & nodes1D() const { return _nodes; }
+    const std::vector<Real> & points1D() const { return _points; }
+    const std::vector<Real> & weights1D() const { return _weights; }
+
+    // Values at the quadrature points (lexicographic order) of n_fields fields:
+    void interpolate(const Real * u, Real * u_q, unsigned int n_fields=1) const;
+
+    // Derivative with respect to the reference coordinate 'dir' at the quadrature points:
+    void derivative(unsigned int dir, const Real * u, Real * du_q, unsigned int n_fields=1) const;
+
+    // Adds sum_q f_q phi_i(x_q) to r_i (transpose of interpolate()):
+    void integrate(const Real * f_q, Real * r, unsigned int n_fields=1) const;
+
+    // Adds sum_q g_q dphi_i/dxi_dir(x_q) to r_i (transpose of derivative()):
+    void integrateDerivative(unsigned int dir, const Real * g_q, Real * r, unsigned int n_fields=1) const;
+
+protected:
+    // Applies the 1D matrix M (rows x cols) in the direction dir of the array in (sizes of the directions in sizes):
+    void contract(const Real * M, unsigned int rows, unsigned int cols, unsigned int dir,
+                  const unsigned int * sizes, unsigned int n_fields, const Real * in, Real * out) const;
+
+    // Applies one matrix per direction (B or D, or their transposes):
+    void apply(const std::vector<Real> * const * M, bool transpose, unsigned int n_fields, const Real * in, Real * out) const;
+
+    unsigned int _p;
+    unsigned int _dim;
+    unsigned int _n_nodes;
+    unsigned int _n_points;
+    unsigned int _n_nodes_elem;
+    unsigned int _n_points_elem;
+
+    std::vector<Real> _nodes;
+    std::vector<Real> _points;
+    std::vector<Real> _weights;
+
+    // Values and derivatives of the 1D basis at the Gauss points (n_points x n_nodes) and their transposes:
+    std::vector<Real> _B, _D, _Bt, _Dt;
+
+    // Work arrays of the contractions and result of the integrations:
+    mutable std::vector<Real> _work1, _work2, _result;
+};
+
+#endif // EELTENSORPRODUCTBASIS_H
@@ -0,0 +1,153 @@
+#
+#####################################################################
+# Finite difference check of the jacobian of the Euler equations   #
+# with the stiffened gas equation of state and a non-zero q.       #
+#####################################################################
+#
+
+[GlobalParams]
+###### Initial Conditions #######
+pressure_init_left = 1.e6
+pressure_init_right = 0.5e6
+vel_init_left = 5.
+vel_init_right = 2.
+temp_init_left = 453
+temp_init_right = 400
+membrane = 0.5
+length = 0.5
+[]
+
+[UserObjects]
+    [./eos]
+    type = StiffenedGasEquationOfState
+    gamma = 2.35
+    Pinf = 1.e9
+    q = -1167e3
+    Cv = 1816
+    q_prime = 0
+    [../]
+[]
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 4
+  xmin = 0
+  xmax = 1
+  block_id = '0'
+[]
+
+[Functions]
+  [./area]
+    type = AreaFunction
+    left = 0.0
+    length = 1.
+    Ao = 1.0
+    Bo = 0.0
+  [../]
+[]
+
+[Variables]
+  [./rhoA]
+    family = LAGRANGE
+    [./InitialCondition]
+        type = ConservativeVariables1DXIC
+        eos = eos
+        area = area
+    [../]
+  [../]
+
+  [./rhouA]
+    family = LAGRANGE
+    [./InitialCondition]
+        type = ConservativeVariables1DXIC
+        eos = eos
+        area = area
+    [../]
+  [../]
+
+  [./rhoEA]
+    family = LAGRANGE
+    [./InitialCondition]
+        type = ConservativeVariables1DXIC
+        eos = eos
+        area = area
+    [../]
+  [../]
+[]
+
+[Kernels]
+  [./Mass]
+    type = EelMass
+    variable = rhoA
+    rhouA_x = rhouA
+  [../]
+
+  [./Momentum]
+    type = EelMomentum
+    variable = rhouA
+    rhoA = rhoA
+    rhouA_x = rhouA
+    rhoEA = rhoEA
+    pressure = pressure_aux
+    area = area_aux
+    eos = eos
+  [../]
+
+  [./Energy]
+    type = EelEnergy
+    variable = rhoEA
+    rhoA = rhoA
+    rhouA_x = rhouA
+    pressure = pressure_aux
+    area = area_aux
+    eos = eos
+  [../]
+[]
+
+[AuxVariables]
+   [./area_aux]
+      family = LAGRANGE
+   [../]
+
+   [./pressure_aux]
+      family = LAGRANGE
+   [../]
+[]
+
+[AuxKernels]
+  [./AreaAK]
+    type = FunctionAux
+    variable = area_aux
+    function = area
+  [../]
+
+  [./PressAK]
+    type = PressureAux
+    variable = pressure_aux
+    rhoA = rhoA
+    rhouA_x = rhouA
+    rhoEA = rhoEA
+    area = area_aux
+    eos = eos
+  [../]
+[]
+
+[Preconditioning]
+  [./SMP]
+    type = SMP
+    full = true
+    solve_type = 'NEWTON'
+    petsc_options_iname = '-snes_type'
+    petsc_options_value = 'test'
+  [../]
+[]
+
+[Executioner]
+  # The time derivatives only add an exact mass matrix: the steady operator is checked alone.
+  type = Steady
+[]
+
+[Outputs]
+  console = true
+[]